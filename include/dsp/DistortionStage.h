@@ -8,6 +8,13 @@
     Distortion stage for aggressive vocal textures.
     Implements 7 distortion types.
 
+    SampleType is either float or a SIMD register holding one voice per lane.
+    Polynomial, clipping, tanh and sine shapers run natively on the register;
+    bitcrush and wavefolder fall back to a per-lane loop.
+
+    processBlock can run the shaper oversampled (2x, 4x or 8x) so that high
+    drive settings don't alias; only this stage pays for the higher rate.
+
   ==============================================================================
 */
 
@@ -15,10 +22,14 @@
 
 #include <juce_dsp/juce_dsp.h>
 #include <juce_audio_basics/juce_audio_basics.h>
+#include "SIMDLanes.h"
+#include "FastMath.h"
+#include "Oversampler.h"
 
 namespace Growl {
 namespace DSP {
 
+template <typename SampleType>
 class DistortionStage
 {
 public:
@@ -63,84 +74,161 @@ public:
         aggression = juce::jlimit (0.0f, 1.0f, newAggression);
     }
 
-    float process (float input) noexcept
+    /**
+        Oversamples the shaper in processBlock by 2^factorLog2 (0 = off, up to
+        3 = 8x). Allocates and designs filters, so call it from prepare time.
+    */
+    void setOversampling (int factorLog2, OversamplingFilter filter)
+    {
+        oversampler.setOversampling (factorLog2, filter);
+    }
+
+    int getOversamplingFactor() const noexcept
+    {
+        return oversampler.getFactor();
+    }
+
+    /** Delay added by the oversampling filters, in samples at the base rate. */
+    double getLatencyInSamples() const noexcept
     {
+        return oversampler.getLatencyInSamples();
+    }
+
+    SampleType process (SampleType input) noexcept
+    {
+        using L = Lanes<SampleType>;
+
         // Apply drive
-        float driven = input * drive;
+        SampleType driven = input * drive;
 
         // Apply distortion
-        float distorted = 0.0f;
+        SampleType distorted = 0.0f;
         switch (distortionType)
         {
             case SoftClip:   distorted = softClip(driven); break;
             case HardClip:   distorted = hardClip(driven); break;
             case Waveshape:  distorted = waveShape(driven); break;
             case Chebyshev:  distorted = chebyshev(driven); break;
-            case Bitcrush:   distorted = bitcrush(driven); break;
-            case Wavefolder: distorted = waveFolder(driven); break;
+            case Bitcrush:   distorted = L::map (driven, [this] (float x) { return bitcrush (x); }); break;
+            case Wavefolder: distorted = L::map (driven, [this] (float x) { return waveFolder (x); }); break;
             case HarmonicBalancer: distorted = harmonicBalance(driven); break;
         }
 
         // Blend based on warmth
-        float output = distorted * (1.0f - warmth) + input * warmth;
+        SampleType output = distorted * (1.0f - warmth) + input * warmth;
 
         // Apply aggression (boost highs)
         if (aggression > 0.0f)
         {
-            float aggressiveBoost = output * (1.0f + aggression * 0.5f);
-            output = juce::jlimit(-1.0f, 1.0f, aggressiveBoost);
+            SampleType aggressiveBoost = output * (1.0f + aggression * 0.5f);
+            output = L::clamp (aggressiveBoost, -1.0f, 1.0f);
         }
 
         return output;
     }
 
-    void processBlock (float* output, const float* input, int numSamples) noexcept
+    /**
+        Processes a whole buffer (output may alias input), oversampled if
+        setOversampling() asked for it. The distortion type is resolved once
+        per block, so each shaper runs in its own tight loop.
+    */
+    void processBlock (SampleType* output, const SampleType* input, int numSamples) noexcept
     {
-        for (int i = 0; i < numSamples; ++i)
-            output[i] = process(input[i]);
+        if (oversampler.getFactor() > 1)
+            oversampler.process (output, input, numSamples, [this] (SampleType* block, int n) { distortBlock (block, block, n); });
+        else
+            distortBlock (output, input, numSamples);
     }
 
     void reset() noexcept
     {
-        // No state to reset
+        oversampler.reset();
+    }
+
+    /** Clears the oversampling filter history of a single voice lane. */
+    void resetLane (size_t lane) noexcept
+    {
+        oversampler.resetLane (lane);
     }
 
 private:
     //==============================================================================
-    float softClip (float x) noexcept
+    void distortBlock (SampleType* output, const SampleType* input, int numSamples) noexcept
+    {
+        using L = Lanes<SampleType>;
+
+        switch (distortionType)
+        {
+            case SoftClip:   shapeBlock (output, input, numSamples, [this] (SampleType x) { return softClip (x); }); break;
+            case HardClip:   shapeBlock (output, input, numSamples, [this] (SampleType x) { return hardClip (x); }); break;
+            case Waveshape:  shapeBlock (output, input, numSamples, [this] (SampleType x) { return waveShape (x); }); break;
+            case Chebyshev:  shapeBlock (output, input, numSamples, [this] (SampleType x) { return chebyshev (x); }); break;
+            case Bitcrush:   shapeBlock (output, input, numSamples, [this] (SampleType x) { return L::map (x, [this] (float s) { return bitcrush (s); }); }); break;
+            case Wavefolder: shapeBlock (output, input, numSamples, [this] (SampleType x) { return L::map (x, [this] (float s) { return waveFolder (s); }); }); break;
+            case HarmonicBalancer: shapeBlock (output, input, numSamples, [this] (SampleType x) { return harmonicBalance (x); }); break;
+        }
+    }
+
+    /** Drive, shaper, warmth blend and aggression for a block; same maths as process(). */
+    template <typename Shaper>
+    void shapeBlock (SampleType* output, const SampleType* input, int numSamples, Shaper&& shape) noexcept
+    {
+        const float dry = warmth;
+        const float wet = 1.0f - warmth;
+        const float boost = 1.0f + aggression * 0.5f;
+
+        if (aggression > 0.0f)
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const SampleType x = input[i];
+                output[i] = Lanes<SampleType>::clamp ((shape (x * drive) * wet + x * dry) * boost, -1.0f, 1.0f);
+            }
+        }
+        else
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const SampleType x = input[i];
+                output[i] = shape (x * drive) * wet + x * dry;
+            }
+        }
+    }
+
+    SampleType softClip (SampleType x) noexcept
     {
         // Soft clipping using tanh
-        return std::tanh(x);
+        return FastMath::tanh(x);
     }
 
-    float hardClip (float x) noexcept
+    SampleType hardClip (SampleType x) noexcept
     {
         // Hard clipping
-        return juce::jlimit(-1.0f, 1.0f, x);
+        return Lanes<SampleType>::clamp (x, -1.0f, 1.0f);
     }
 
-    float waveShape (float x) noexcept
+    SampleType waveShape (SampleType x) noexcept
     {
         // Waveshaping using cubic function
-        float x2 = x * x;
-        float x3 = x2 * x;
-        return juce::jlimit(-1.0f, 1.0f, x + 0.3f * x2 + 0.1f * x3);
+        SampleType x2 = x * x;
+        SampleType x3 = x2 * x;
+        return Lanes<SampleType>::clamp (x + x2 * 0.3f + x3 * 0.1f, -1.0f, 1.0f);
     }
 
-    float chebyshev (float x) noexcept
+    SampleType chebyshev (SampleType x) noexcept
     {
-        // Chebyshev polynomial (adds harmonics)
-        float x2 = x * x;
-        float t2 = 2.0f * x2 - 1.0f; // 2nd Chebyshev polynomial
-        float t3 = 4.0f * x2 * x - 3.0f * x; // 3rd Chebyshev polynomial
-        return 0.5f * x + 0.3f * t2 + 0.2f * t3;
+        // Chebyshev polynomial (adds harmonics), offset so that silence stays silent
+        SampleType x2 = x * x;
+        SampleType t2 = x2 * 2.0f - 1.0f; // 2nd Chebyshev polynomial
+        SampleType t3 = x2 * x * 4.0f - x * 3.0f; // 3rd Chebyshev polynomial
+        return x * 0.5f + (t2 + 1.0f) * 0.3f + t3 * 0.2f;
     }
 
     float bitcrush (float x) noexcept
     {
         // Bitcrushing (quantization)
         float bits = 16.0f - (drive * 14.0f); // 2 to 16 bits
-        float levels = std::pow(2.0f, bits);
+        float levels = FastMath::exp2(bits);
         float crushed = std::floor(x * levels) / levels;
         return juce::jlimit(-1.0f, 1.0f, crushed);
     }
@@ -159,11 +247,11 @@ private:
         return (x < 0.0f ? -1.0f : 1.0f) * folded;
     }
 
-    float harmonicBalance (float x) noexcept
+    SampleType harmonicBalance (SampleType x) noexcept
     {
-        // Harmonic balancer (even/odd harmonic balance)
-        float even = std::cos(x * juce::MathConstants<float>::pi);
-        float odd = std::sin(x * juce::MathConstants<float>::pi);
+        // Harmonic balancer (even/odd harmonic balance), offset so that silence stays silent
+        SampleType even = FastMath::cos(x * juce::MathConstants<float>::pi) - 1.0f;
+        SampleType odd = FastMath::sin(x * juce::MathConstants<float>::pi);
         return (even + odd) * 0.5f;
     }
 
@@ -172,6 +260,7 @@ private:
     float drive;
     float warmth;
     float aggression;
+    Oversampler<SampleType> oversampler;
 
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (DistortionStage)
@@ -0,0 +1,173 @@
+/*
+  ==============================================================================
+
+    FastMath.h
+    Created: 17 Oct 2026 3:10:00pm
+    Author:  White Room Audio
+
+    Polynomial and rational approximations of the transcendental functions
+    used on the DSP hot paths. Each one is branch-free and templated on
+    SampleType, so it runs on plain floats or natively on a register of
+    voice lanes. The worst-case errors below are checked against the
+    standard library in GrowlDSPTest.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <bit>
+#include <cstdint>
+#include "SIMDLanes.h"
+
+namespace Growl {
+namespace DSP {
+namespace FastMath {
+
+//==============================================================================
+/** Adding 1.5 * 2^23 leaves only whole numbers in the mantissa; the sum's bits are then shifterBits + n. */
+constexpr float shifter = 12582912.0f;
+constexpr int32_t shifterBits = 0x4b400000;
+
+/** Rounds to the nearest integer by pushing the fraction out of the mantissa; exact for |x| < 2^22. */
+template <typename SampleType>
+inline SampleType roundToInteger (SampleType x) noexcept
+{
+    return (x + shifter) - shifter;
+}
+
+//==============================================================================
+namespace Detail
+{
+    constexpr float pi = 3.14159265358979f;
+    constexpr float halfPi = 1.57079632679490f;
+    constexpr float inverseTwoPi = 0.159154943091895f;
+
+    // 2pi split so that k * twoPiHigh is exact for |k| < 2^15 (Cody-Waite reduction)
+    constexpr float twoPiHigh = 6.28125f;
+    constexpr float twoPiLow = 1.9353071795864769e-3f;
+
+    /** sin(r) for r in [-pi/2, pi/2]: an odd degree-9 fit. */
+    template <typename SampleType>
+    inline SampleType sinPolynomial (SampleType r) noexcept
+    {
+        const SampleType r2 = r * r;
+        return r * ((((r2 * 2.592816222e-6f - 1.980225468e-4f) * r2 + 8.332926737e-3f) * r2 - 0.1666664969f) * r2 + 0.9999999812f);
+    }
+
+    /** sin(r) for r in [-pi, pi]. */
+    template <typename SampleType>
+    inline SampleType sinReduced (SampleType r) noexcept
+    {
+        using L = Lanes<SampleType>;
+
+        // sin (r) = sin (pi - r) folds the range onto [-pi/2, pi/2]
+        r = L::max (L::min (r, SampleType (pi) - r), SampleType (-pi) - r);
+        return sinPolynomial (r);
+    }
+}
+
+/** sin(x). Absolute error below 6e-7 for |x| <= 1000; range reduction loses accuracy beyond that. */
+template <typename SampleType>
+inline SampleType sin (SampleType x) noexcept
+{
+    const SampleType k = roundToInteger (x * Detail::inverseTwoPi);
+    return Detail::sinReduced (x - k * Detail::twoPiHigh - k * Detail::twoPiLow);
+}
+
+/** cos(x), with the same error bound as sin(). The quarter-turn shift is added after reduction, where it is exact enough. */
+template <typename SampleType>
+inline SampleType cos (SampleType x) noexcept
+{
+    const SampleType k = roundToInteger (x * Detail::inverseTwoPi + 0.25f);
+    return Detail::sinReduced (x - k * Detail::twoPiHigh - k * Detail::twoPiLow + Detail::halfPi);
+}
+
+/**
+    sin(x) and cos(x) for x in [0, pi/2], with no range reduction; for filter
+    prewarping, where tan(x) = sin / cos. The cosine is sin (pi/2 - x), so it
+    keeps its relative accuracy as it approaches zero. Absolute error below 6e-7.
+*/
+template <typename SampleType>
+inline void sinCosQuarterTurn (SampleType x, SampleType& sinOut, SampleType& cosOut) noexcept
+{
+    sinOut = Detail::sinPolynomial (x);
+    cosOut = Detail::sinPolynomial (SampleType (Detail::halfPi) - x);
+}
+
+/**
+    tanh(x) from the [9/8] Pade approximant (Lambert's continued fraction),
+    with the input clamped to +/-7 and the output to +/-1. Absolute error below 1e-5.
+*/
+template <typename SampleType>
+inline SampleType tanh (SampleType x) noexcept
+{
+    using L = Lanes<SampleType>;
+
+    x = L::clamp (x, -7.0f, 7.0f);
+    const SampleType x2 = x * x;
+    const SampleType numerator = x * ((((x2 + 990.0f) * x2 + 135135.0f) * x2 + 4729725.0f) * x2 + 34459425.0f);
+    const SampleType denominator = (((x2 * 45.0f + 13860.0f) * x2 + 945945.0f) * x2 + 16216200.0f) * x2 + 34459425.0f;
+    return L::clamp (L::divide (numerator, denominator), -1.0f, 1.0f);
+}
+
+//==============================================================================
+/** 2^x for x in [-126, 126] (clamped). Relative error below 4e-7. */
+template <typename SampleType>
+inline SampleType exp2 (SampleType x) noexcept
+{
+    using L = Lanes<SampleType>;
+
+    x = L::clamp (x, -126.0f, 126.0f);
+
+    const SampleType shifted = x + shifter;
+    const SampleType f = x - (shifted - shifter);   // [-0.5, 0.5]
+    const SampleType p = ((((f * 1.340043217e-3f + 9.676037098e-3f) * f + 5.550327214e-2f) * f + 0.2402210736f) * f + 0.6931472067f) * f + 1.000000075f;
+
+    // 2^n built directly in the exponent field, from the n the rounding left in the mantissa
+    auto bits = L::toBits (shifted);
+
+    for (auto& b : bits)
+        b = (b - shifterBits + 127) << 23;
+
+    return p * L::fromBits (bits);
+}
+
+/** log2(x) for positive, normal x. Absolute error below 2e-7. */
+template <typename SampleType>
+inline SampleType log2 (SampleType x) noexcept
+{
+    using L = Lanes<SampleType>;
+
+    // Split off the exponent so that the mantissa lands in [sqrt(1/2), sqrt(2)),
+    // and turn the exponent back into a float through the rounding shifter
+    auto mantissaBits = L::toBits (x);
+    typename L::Bits exponentBits;
+
+    for (size_t i = 0; i < L::size; ++i)
+    {
+        const int32_t exponent = (mantissaBits[i] - 0x3f3504f3) >> 23;
+        mantissaBits[i] -= exponent << 23;
+        exponentBits[i] = shifterBits + exponent;
+    }
+
+    const SampleType m = L::fromBits (mantissaBits);
+    const SampleType exponent = L::fromBits (exponentBits) - shifter;
+
+    // Odd fit in s = (m - 1) / (m + 1), |s| < 0.172
+    const SampleType s = L::divide (m - 1.0f, m + 1.0f);
+    const SampleType s2 = s * s;
+    return exponent + s * (((s2 * 0.4338455049f + 0.5766068975f) * s2 + 0.9618003993f) * s2 + 2.885390074f);
+}
+
+/** x^y for positive x, as exp2 (y * log2 (x)). Relative error below 4e-7 + 1.4e-7 * |y * log2 (x)|. */
+template <typename SampleType>
+inline SampleType pow (SampleType x, float y) noexcept
+{
+    return FastMath::exp2 (FastMath::log2 (x) * y);
+}
+
+} // namespace FastMath
+} // namespace DSP
+} // namespace Growl
@@ -0,0 +1,153 @@
+/*
+  ==============================================================================
+
+    FormantSizeTable.h
+    Created: 17 Oct 2026 9:40:00pm
+    Author:  White Room Audio
+
+    Formant filter coefficients for one preset, precomputed over a log-spaced
+    creature-size axis, so that a voice's size can change without evaluating
+    SizeScaler or any trig on the audio thread.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <cmath>
+#include "FastMath.h"
+#include "SizeScaler.h"
+
+namespace Growl {
+namespace DSP {
+
+/** The most formants a ResonanceSystem or a size table holds. */
+constexpr int maxFormants = 8;
+
+/** A lion growl, continued upwards; used for formants nobody has set. */
+constexpr float defaultFormantFreqs[maxFormants] = { 200.0f, 440.0f, 800.0f, 1500.0f, 2500.0f, 3500.0f, 4500.0f, 5500.0f };
+constexpr float defaultFormantQs[maxFormants] = { 8.0f, 8.0f, 6.0f, 5.0f, 4.0f, 4.0f, 4.0f, 4.0f };
+
+//==============================================================================
+/**
+    One row per size, from minSizeFeet to maxSizeFeet (SizeScaler's range) in
+    equal ratios. Each row holds, per formant, the unit-gain band-pass biquad
+    and the SVF prewarp angle for the preset formant scaled to that size.
+    There are always maxFormants columns, so one table serves a
+    ResonanceSystem of any formant count, which reads the first ones.
+
+    build() runs on the message thread. lookup() is a linear interpolation
+    between two rows and is cheap enough to run per voice at control rate.
+    Interpolating two stable band-pass biquads is itself stable, since the
+    (a1, a2) stability triangle is convex and b0 only scales the output.
+*/
+class FormantSizeTable
+{
+public:
+    static constexpr int numSizes = 128;
+    static constexpr float minSizeFeet = 1.0f;
+    static constexpr float maxSizeFeet = 10000.0f;
+
+    /** Interpolated coefficients for one size. */
+    struct Coefficients
+    {
+        float b0[maxFormants];
+        float a1[maxFormants];
+        float a2[maxFormants];
+        float warp[maxFormants];   // pi * f / sampleRate
+    };
+
+    FormantSizeTable()
+    {
+        build (defaultFormantFreqs, defaultFormantQs, 48000.0, SizeScaler::Allometric);
+    }
+
+    /**
+        Fills the table for maxFormants formants tuned at the reference size,
+        scaled the way GrowlProcessor::applyPreset scales them. Not for the
+        audio thread.
+    */
+    void build (const float* formantFreqs, const float* formantQs, double newSampleRate, SizeScaler::ScalingType scalingType)
+    {
+        sampleRate = newSampleRate;
+        SizeScaler scaler;
+        scaler.setScalingType (scalingType);
+
+        for (int i = 0; i < maxFormants; ++i)
+            k[i] = 1.0f / juce::jlimit (1.0f, 20.0f, formantQs[i]);
+
+        for (int row = 0; row < numSizes; ++row)
+        {
+            scaler.setSizeFeet (sizeOfRow (row));
+            const float multiplier = scaler.getFormantMultiplier();
+
+            for (int i = 0; i < maxFormants; ++i)
+            {
+                // The same limit as ResonanceSystem::setFormantFrequency
+                const double freq = juce::jlimit (50.0f, 10000.0f, formantFreqs[i] * multiplier);
+                const double omega = juce::MathConstants<double>::twoPi * freq / sampleRate;
+                const double alpha = std::sin (omega) * 0.5 * static_cast<double> (k[i]);
+                const double a0 = 1.0 + alpha;
+
+                rows[row].b0[i] = static_cast<float> (alpha / a0);
+                rows[row].a1[i] = static_cast<float> (-2.0 * std::cos (omega) / a0);
+                rows[row].a2[i] = static_cast<float> ((1.0 - alpha) / a0);
+                rows[row].warp[i] = static_cast<float> (omega * 0.5);
+            }
+        }
+    }
+
+    /** Fractional row of a size, clamped to the table. Sizes glide in these units, i.e. in equal ratios. */
+    static float positionOf (float sizeFeet) noexcept
+    {
+        const float octaves = FastMath::log2 (juce::jlimit (minSizeFeet, maxSizeFeet, sizeFeet) / minSizeFeet);
+        return octaves * rowsPerOctave;
+    }
+
+    /** Coefficients of the first NumFormants formants at a fractional row from positionOf(). */
+    template <int NumFormants>
+    void lookup (float position, Coefficients& out) const noexcept
+    {
+        static_assert (NumFormants <= maxFormants);
+
+        const float clamped = juce::jlimit (0.0f, static_cast<float> (numSizes - 1), position);
+        const int row = juce::jmin (static_cast<int> (clamped), numSizes - 2);
+        const float frac = clamped - static_cast<float> (row);
+        const auto& lo = rows[row];
+        const auto& hi = rows[row + 1];
+
+        for (int i = 0; i < NumFormants; ++i)
+        {
+            out.b0[i] = lo.b0[i] + (hi.b0[i] - lo.b0[i]) * frac;
+            out.a1[i] = lo.a1[i] + (hi.a1[i] - lo.a1[i]) * frac;
+            out.a2[i] = lo.a2[i] + (hi.a2[i] - lo.a2[i]) * frac;
+            out.warp[i] = lo.warp[i] + (hi.warp[i] - lo.warp[i]) * frac;
+        }
+    }
+
+    /** 1 / Q per formant; it does not change with size. */
+    float getK (int formant) const noexcept     { return k[formant]; }
+
+    double getSampleRate() const noexcept       { return sampleRate; }
+
+private:
+    //==============================================================================
+    static constexpr float rowsPerOctave = static_cast<float> (numSizes - 1) / 13.28771238f;   // log2 (max / min)
+
+    static float sizeOfRow (int row) noexcept
+    {
+        return minSizeFeet * std::exp2 (static_cast<float> (row) / rowsPerOctave);
+    }
+
+    //==============================================================================
+    Coefficients rows[numSizes];
+    float k[maxFormants];
+    double sampleRate = 48000.0;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FormantSizeTable)
+};
+
+} // namespace DSP
+} // namespace Growl
@@ -12,11 +12,19 @@
 
 #pragma once
 
+#include "SIMDLanes.h"
+#include "FastMath.h"
+#include "RandomLanes.h"
 #include "NoiseGenerator.h"
 #include "OscillatorBank.h"
+#include "FormantSizeTable.h"
 #include "ResonanceSystem.h"
+#include "Oversampler.h"
 #include "DistortionStage.h"
 #include "SizeScaler.h"
 #include "ModulationSystem.h"
+#include "VoicePool.h"
+#include "VoiceAllocator.h"
+#include "RenderThreadPool.h"
 #include "GrowlProcessor.h"
 #include "Preset.h"
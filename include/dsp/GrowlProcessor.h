@@ -18,129 +18,774 @@
 #include "NoiseGenerator.h"
 #include "OscillatorBank.h"
 #include "ResonanceSystem.h"
+#include "FormantSizeTable.h"
 #include "DistortionStage.h"
 #include "SizeScaler.h"
 #include "ModulationSystem.h"
+#include "VoicePool.h"
+#include "VoiceAllocator.h"
+#include "RenderThreadPool.h"
+#include "Preset.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iterator>
+#include <vector>
 
 namespace Growl {
 namespace DSP {
 
-struct Voice
-{
-    bool active = false;
-    int noteNumber = 0;
-    float velocity = 0.0f;
-    float age = 0.0f;
-};
-
 class GrowlProcessor
 {
 public:
+    static constexpr int maxVoices = 256;
+
+    /** Blocks shorter than this are always rendered on the calling thread. */
+    static constexpr int minSamplesForThreads = 32;
+
+    /** Block peak of the formant output (about -80 dB) below which a released voice goes to sleep. */
+    static constexpr float sleepThreshold = 1.0e-4f;
+
+    using Pool = VoicePool<maxVoices>;
+
     GrowlProcessor()
     {
-        // Initialize all voices to inactive
-        for (auto& voice : voices)
-            voice.active = false;
+        // Give every voice its own noise sequence and unison phases so stacked voices don't sum coherently
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            pool.noise[v].setSeed (123456789u + static_cast<uint32_t> (v) * 0x9E3779B9u);
+            pool.oscillators[v].setSeed (987654321u + static_cast<uint32_t> (v) * 0x9E3779B9u);
+        }
+
+        for (int g = 0; g < Pool::numGroups; ++g)
+            pool.groupNoise[g].setSeed (362436069u + static_cast<uint32_t> (g) * 0x9E3779B9u);
+
+        scratch.front().allocate (maxBlockSize);
     }
 
     ~GrowlProcessor() = default;
 
-    void prepare (double sampleRate, int samplesPerBlock)
+    /**
+        Sets how many threads render voices, counting the audio thread.
+        1 (the default) renders everything on the audio thread. Takes effect
+        on the next call to prepare().
+    */
+    void setNumRenderThreads (int numThreads)
+    {
+        numRenderThreads = juce::jlimit (1, RenderThreadPool::maxThreads, numThreads);
+    }
+
+    /**
+        Oversamples the distortion stage of every voice by 2^factorLog2
+        (0 = off, 1 = 2x, 2 = 4x, 3 = 8x). Takes effect on the next call to
+        prepare(); getLatencyInSamples() then reports the added delay.
+    */
+    void setOversampling (int factorLog2, OversamplingFilter filter)
     {
+        oversamplingFactorLog2 = juce::jlimit (0, Oversampler<VoiceLanes>::maxStages, factorLog2);
+        oversamplingFilter = filter;
+    }
+
+    /**
+        Makes every voice read its noise from the process-wide precomputed
+        tables instead of generating it; see NoiseGenerator::setUseSharedTables.
+        Call from the message thread.
+    */
+    void setUseSharedNoiseTables (bool shouldUseTables)
+    {
+        useSharedNoiseTables = shouldUseTables;
+
+        for (int v = 0; v < maxVoices; ++v)
+            pool.noise[v].setUseSharedTables (shouldUseTables);
+    }
+
+    /** Runs every voice's formants on biquads or on state-variable filters; see ResonanceSystem::setEngine. */
+    void setFormantEngine (FormantEngine engine)
+    {
+        for (int g = 0; g < Pool::numGroups; ++g)
+            pool.resonance[g].setEngine (engine);
+    }
+
+    /** Latency added by oversampling, in samples, rounded for reporting to the host. */
+    int getLatencyInSamples() const noexcept
+    {
+        return juce::roundToInt (pool.distortion[0].getLatencyInSamples());
+    }
+
+    void prepare (double newSampleRate, int samplesPerBlock)
+    {
+        sampleRate = newSampleRate;
+        maxBlockSize = juce::jmax (1, samplesPerBlock);
+
+        threadPool.stop();
+
+        // One set of scratch buffers per render thread so workers never share them
+        scratch.resize (static_cast<size_t> (numRenderThreads));
+        for (auto& s : scratch)
+            s.allocate (maxBlockSize);
+
+        // In threaded mode every voice group renders into its own buffer so the
+        // mix can be summed in a fixed order, whichever thread rendered it
+        groupBuffers.assign (numRenderThreads > 1 ? static_cast<size_t> (Pool::numGroups * maxBlockSize) : 0, 0.0f);
+
+        if (numRenderThreads > 1)
+            threadPool.start (numRenderThreads - 1);
+
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            pool.noise[v].prepare (sampleRate);
+            pool.oscillators[v].prepare (sampleRate);
+            pool.envelopes[v].prepare (sampleRate);
+        }
+
+        for (int g = 0; g < Pool::numGroups; ++g)
+        {
+            pool.resonance[g].prepare (sampleRate);
+            pool.distortion[g].setOversampling (oversamplingFactorLog2, oversamplingFilter);
+        }
+
+        rebuildFormantTable();
+        adoptFormantTable();
+
         modulation.prepare(sampleRate, samplesPerBlock);
         reset();
     }
 
+    /**
+        Makes band-pass noise follow the preset's first formant (scaled by
+        creature size) instead of the fixed 300-3000 Hz voice band.
+    */
+    void setNoiseTracksFirstFormant (bool shouldTrack)
+    {
+        noiseTracksFirstFormant = shouldTrack;
+        updateNoiseBand();
+    }
+
+    void setOscillatorMix (float mix)
+    {
+        oscillatorMix = juce::jlimit (0.0f, 1.0f, mix);
+    }
+
+    /**
+        Applies a preset to every voice, scaling its formants by the creature
+        size. For callers that don't render on another thread; a plugin calls
+        its two halves, publishPresetFormants() and then applyPresetToVoices().
+    */
+    void applyPreset (const PresetParameters& preset)
+    {
+        publishPresetFormants (preset);
+        applyPresetToVoices (preset);
+    }
+
+    /**
+        Builds the size table for a preset's formants, the slow part of a
+        preset change, and hands it to the audio thread, which picks it up
+        at its next block. It touches nothing else the audio thread reads,
+        so it runs while rendering carries on. Message thread.
+    */
+    void publishPresetFormants (const PresetParameters& preset)
+    {
+        std::copy (std::begin (preset.formantFreqs), std::end (preset.formantFreqs), presetFormantFreqs);
+        std::copy (std::begin (preset.formantQs), std::end (preset.formantQs), presetFormantQs);
+        rebuildFormantTable();
+    }
+
+    /**
+        Sets every voice's parameters from a preset. A change in the formant
+        count swaps every voice group's filter bank, so hold processing off
+        while it runs (the plugin takes its callback lock); publish the
+        preset's formants first.
+    */
+    void applyPresetToVoices (const PresetParameters& preset)
+    {
+        sizeScaler.setSizeFeet (preset.sizeFeet);
+        sizeScaler.setScalingType (SizeScaler::Allometric);
+
+        noiseType = toNoiseType (preset.noiseType);
+
+        for (int g = 0; g < Pool::numGroups; ++g)
+            pool.groupNoise[g].setNoiseType (noiseType);
+
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            pool.noise[v].setNoiseType (noiseType);
+            pool.oscillators[v].setOscillatorType (toOscillatorType (preset.oscillatorType));
+            pool.oscillators[v].setDetune (preset.oscillatorDetune * 100.0f); // semitones -> cents
+        }
+
+        setOscillatorMix (preset.oscillatorMix);
+
+        auto formantMult = sizeScaler.getFormantMultiplier();
+
+        // The formants come from a table over creature size, and every voice,
+        // held ones included, glides to the preset's size
+        presetSizeFeet = preset.sizeFeet;
+        presetNumFormants = juce::jlimit (1, maxFormants, preset.numFormants);
+
+        for (int v = 0; v < maxVoices; ++v)
+            pool.resonance[Pool::groupOf (v)].setLaneSize (Pool::laneOf (v), presetSizeFeet);
+
+        for (int g = 0; g < Pool::numGroups; ++g)
+        {
+            auto& resonance = pool.resonance[g];
+            resonance.setNumFormants (presetNumFormants);
+            resonance.setChestResonance (preset.chestResonance);
+            resonance.setThroatConstriction (preset.throatResonance);
+            resonance.setMix (preset.resonanceMix);
+
+            auto& distortion = pool.distortion[g];
+            distortion.setDistortionType (toDistortionType (preset.distortionType));
+            distortion.setDrive (preset.drive);
+            distortion.setAggression (preset.tone);
+        }
+
+        firstFormantFrequency = preset.formantFreqs[0] * formantMult;
+        firstFormantQ = preset.formantQs[0];
+        updateNoiseBand();
+    }
+
     void noteOn (int noteNumber, float velocity)
     {
-        // Find free voice
-        for (auto& voice : voices)
+        // A repeated note retriggers its own voice; otherwise take a free one,
+        // and only when the pool is full steal the least audible voice
+        auto v = allocator.getVoiceForNote (noteNumber);
+
+        if (v < 0)
+            v = allocator.allocate();
+
+        if (v < 0)
+            v = findVoiceToSteal();
+
+        allocator.unmapNote (pool.noteNumber[v], v);
+        allocator.mapNote (noteNumber, v);
+
+        startVoice (v, noteNumber, velocity);
+        modulation.noteOn();
+    }
+
+    /**
+        Gives the voice playing noteNumber its own creature size, gliding its
+        formants there; the rest of the preset is unchanged. The coefficients
+        are interpolated from the preset's size table, so this is cheap enough
+        to call every block from the audio thread. A new note starts at the
+        preset's size.
+    */
+    void setNoteSize (int noteNumber, float sizeFeet) noexcept
+    {
+        const auto v = allocator.getVoiceForNote (noteNumber);
+
+        if (v >= 0)
+            pool.resonance[Pool::groupOf (v)].setLaneSize (Pool::laneOf (v), sizeFeet);
+    }
+
+    void noteOff (int noteNumber)
+    {
+        const auto v = allocator.getVoiceForNote (noteNumber);
+
+        if (v >= 0)
         {
-            if (!voice.active)
+            // The voice keeps ringing out; a new note-on for this key gets a fresh voice
+            allocator.unmapNote (noteNumber, v);
+            pool.envelopes[v].noteOff();
+            modulation.noteOff();
+        }
+    }
+
+    /**
+        Renders a block, applying each MIDI event at its own sample position.
+        The block is split at every event and rendered in between, so note
+        starts and envelopes are sample-accurate whatever the host block size.
+    */
+    void processBlock (float* output, int numSamples, const juce::MidiBuffer& midiMessages)
+    {
+        int position = 0;
+
+        for (const auto metadata : midiMessages)
+        {
+            const auto eventPosition = juce::jlimit (position, numSamples, metadata.samplePosition);
+
+            if (eventPosition > position)
             {
-                voice.active = true;
-                voice.noteNumber = noteNumber;
-                voice.velocity = velocity;
-                voice.age = 0.0f;
-                modulation.noteOn();
-                break;
+                processBlock (output + position, eventPosition - position);
+                position = eventPosition;
             }
+
+            handleMidiEvent (metadata.getMessage());
         }
+
+        if (position < numSamples)
+            processBlock (output + position, numSamples - position);
     }
 
-    void noteOff (int noteNumber)
+    void handleMidiEvent (const juce::MidiMessage& message)
     {
-        // Find voice and release
-        for (auto& voice : voices)
+        if (message.isNoteOn())
+            noteOn (message.getNoteNumber(), message.getFloatVelocity());
+        else if (message.isNoteOff())
+            noteOff (message.getNoteNumber());
+        else if (message.isAllNotesOff() || message.isAllSoundOff())
+            allNotesOff();
+    }
+
+    void allNotesOff()
+    {
+        for (int v = 0; v < maxVoices; ++v)
         {
-            if (voice.active && voice.noteNumber == noteNumber)
+            if (pool.active[v])
             {
-                modulation.noteOff();
-                break;
+                allocator.unmapNote (pool.noteNumber[v], v);
+                pool.envelopes[v].noteOff();
             }
         }
+
+        modulation.noteOff();
     }
 
     void processBlock (float* output, int numSamples)
     {
+        adoptFormantTable();
+
         // Clear output
         juce::FloatVectorOperations::fill(output, 0.0f, numSamples);
 
-        // Process active voices
-        for (auto& voice : voices)
+        // Render in chunks that fit the scratch buffers allocated in prepare()
+        for (int start = 0; start < numSamples; start += maxBlockSize)
+            renderVoices (output + start, juce::jmin (maxBlockSize, numSamples - start));
+
+        // Process modulation
+        modulation.process(numSamples);
+    }
+
+    void reset()
+    {
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            pool.noise[v].reset();
+            pool.oscillators[v].reset();
+            pool.envelopes[v].reset();
+            pool.active[v] = false;
+            pool.age[v] = 0.0f;
+            pool.level[v] = 0.0f;
+            pool.tailLevel[v] = 0.0f;
+        }
+
+        allocator.reset();
+
+        for (int g = 0; g < Pool::numGroups; ++g)
         {
-            if (voice.active)
+            pool.groupNoise[g].reset();
+            pool.resonance[g].reset();
+            pool.distortion[g].reset();
+        }
+
+        modulation.reset();
+    }
+
+    int getNumActiveVoices() const noexcept
+    {
+        return maxVoices - allocator.getNumFree();
+    }
+
+    /** Formants per voice in the current preset; the filter banks are specialised for this count. */
+    int getNumFormants() const noexcept
+    {
+        return presetNumFormants;
+    }
+
+    /** Per-voice memory layout of the voice pool. */
+    static constexpr VoiceFootprint getVoiceFootprint() noexcept
+    {
+        return Pool::getFootprint();
+    }
+
+private:
+    //==============================================================================
+    /**
+        Builds the size table for the current preset formants and publishes
+        it to the audio thread, which picks it up in adoptFormantTable().
+        Taking a table out of pendingFormantTable is the audio thread's
+        acknowledgement: a table still pending was never read, so it is taken
+        back and rebuilt in place, and once the last one has been taken the
+        other slot is no longer read. Rendering never sees a half-built
+        table. Runs on the message thread.
+    */
+    void rebuildFormantTable()
+    {
+        auto* table = publishedFormantTable;
+
+        if (pendingFormantTable.exchange (nullptr, std::memory_order_acq_rel) == nullptr)
+            table = table == &formantTables[0] ? &formantTables[1] : &formantTables[0];
+
+        table->build (presetFormantFreqs, presetFormantQs, sampleRate, SizeScaler::Allometric);
+        publishedFormantTable = table;
+        pendingFormantTable.store (table, std::memory_order_release);
+    }
+
+    /** Points every voice group at a newly published size table, recomputing its coefficients. Audio thread. */
+    void adoptFormantTable() noexcept
+    {
+        if (const auto* table = pendingFormantTable.exchange (nullptr, std::memory_order_acq_rel))
+            for (int g = 0; g < Pool::numGroups; ++g)
+                pool.resonance[g].setSizeTable (table);
+    }
+
+    void updateNoiseBand()
+    {
+        const float centre = noiseTracksFirstFormant ? firstFormantFrequency : NoiseGenerator::defaultBandpassCentre;
+        const float q = noiseTracksFirstFormant ? firstFormantQ : NoiseGenerator::defaultBandpassQ;
+
+        for (int v = 0; v < maxVoices; ++v)
+            pool.noise[v].setBandpassBand (centre, q);
+    }
+
+    static NoiseGenerator::NoiseType toNoiseType (::NoiseType type) noexcept
+    {
+        switch (type)
+        {
+            case ::NoiseType::White:     return NoiseGenerator::White;
+            case ::NoiseType::Pink:      return NoiseGenerator::Pink;
+            case ::NoiseType::Brown:     return NoiseGenerator::Brown;
+            case ::NoiseType::Bandpass:  return NoiseGenerator::Bandpass;
+            case ::NoiseType::PinkMixed: return NoiseGenerator::PinkMixed;
+            default:                     return NoiseGenerator::Pink;
+        }
+    }
+
+    static OscillatorBank::OscillatorType toOscillatorType (::OscillatorType type) noexcept
+    {
+        switch (type)
+        {
+            case ::OscillatorType::Detuned:    return OscillatorBank::Detuned;
+            case ::OscillatorType::DPW:        return OscillatorBank::DPW;
+            case ::OscillatorType::PolyBLEP:   return OscillatorBank::PolyBLEP;
+            case ::OscillatorType::Wavetable:  return OscillatorBank::Wavetable;
+            case ::OscillatorType::Wavefolder: return OscillatorBank::DPW; // folding happens in the distortion stage
+            default:                           return OscillatorBank::Detuned;
+        }
+    }
+
+    static DistortionStage<VoiceLanes>::DistortionType toDistortionType (::DistortionType type) noexcept
+    {
+        using Distortion = DistortionStage<VoiceLanes>;
+
+        switch (type)
+        {
+            case ::DistortionType::SoftClip:         return Distortion::SoftClip;
+            case ::DistortionType::Waveshape:        return Distortion::Waveshape;
+            case ::DistortionType::HarmonicBalancer: return Distortion::HarmonicBalancer;
+            case ::DistortionType::Chebyshev:        return Distortion::Chebyshev;
+            case ::DistortionType::Wavefolder:       return Distortion::Wavefolder;
+            case ::DistortionType::Bitcrush:         return Distortion::Bitcrush;
+            default:                                 return Distortion::SoftClip;
+        }
+    }
+
+    /**
+        Picks the voice to recycle when the pool is full: the quietest voice
+        already in its release stage, or if none is releasing, the quietest
+        held voice. Ties go to the oldest voice. Only runs when every voice is
+        busy; the common path above is constant time.
+    */
+    int findVoiceToSteal() const noexcept
+    {
+        int best = 0;
+        bool bestReleasing = false;
+
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            const bool releasing = ! pool.envelopes[v].isNoteOn();
+
+            if (releasing != bestReleasing)
             {
-                // Generate noise
-                noise.processBlock(output, numSamples);
+                if (releasing)
+                {
+                    best = v;
+                    bestReleasing = true;
+                }
+
+                continue;
+            }
+
+            if (pool.level[v] < pool.level[best]
+                || (pool.level[v] == pool.level[best] && pool.age[v] > pool.age[best]))
+                best = v;
+        }
+
+        return best;
+    }
+
+    /**
+        Starts a note on voice v. A sleeping voice starts from a clean state.
+        A voice that is still sounding (retriggered or stolen) keeps its
+        oscillator phase and filter state and its envelope attacks from the
+        current level, so the new note takes over without a click.
+    */
+    void startVoice (int v, int noteNumber, float velocity)
+    {
+        const bool wasSounding = pool.active[v];
+
+        pool.active[v] = true;
+        pool.noteNumber[v] = noteNumber;
+        pool.velocity[v] = velocity;
+        pool.age[v] = 0.0f;
+        pool.level[v] = velocity;
+        pool.tailLevel[v] = velocity;
+
+        if (! wasSounding)
+            pool.oscillators[v].reset();
+
+        pool.oscillators[v].setFrequency (440.0f * FastMath::exp2 (static_cast<float> (noteNumber - 69) / 12.0f));
+        pool.resonance[Pool::groupOf (v)].setLaneSize (Pool::laneOf (v), presetSizeFeet);
 
-                // Add resonance
-                for (int i = 0; i < numSamples; ++i)
-                    output[i] = resonance.process(output[i]);
+        if (! wasSounding)
+        {
+            pool.resonance[Pool::groupOf (v)].resetLane (Pool::laneOf (v));
+            pool.distortion[Pool::groupOf (v)].resetLane (Pool::laneOf (v));
+        }
+
+        pool.envelopes[v].noteOn();
+    }
 
-                // Apply distortion
-                for (int i = 0; i < numSamples; ++i)
-                    output[i] = distortion.process(output[i]);
+    /** Scratch buffers owned by one render thread. */
+    struct RenderScratch
+    {
+        std::vector<float> voice, oscillator, group;
+        std::vector<VoiceLanes> lanes;
+
+        void allocate (int numSamples)
+        {
+            voice.assign (static_cast<size_t> (numSamples), 0.0f);
+            oscillator.assign (static_cast<size_t> (numSamples), 0.0f);
+            group.assign (static_cast<size_t> (numSamples), 0.0f);
+            lanes.assign (static_cast<size_t> (numSamples), VoiceLanes (0.0f));
+        }
+    };
 
-                voice.age += static_cast<float>(numSamples) / 48000.0f;
+    void renderVoices (float* output, int numSamples)
+    {
+        // Collect the voice groups with at least one sounding voice
+        numActiveGroups = 0;
+
+        if (getNumActiveVoices() == 0)
+            return;
+
+        for (int g = 0; g < Pool::numGroups; ++g)
+        {
+            const int firstVoice = g * Pool::laneWidth;
+            bool groupActive = false;
+
+            for (int lane = 0; lane < Pool::laneWidth; ++lane)
+                groupActive = groupActive || pool.active[firstVoice + lane];
+
+            if (groupActive)
+                activeGroups[static_cast<size_t> (numActiveGroups++)] = g;
+        }
 
-                // Voice stealing (oldest voice)
-                if (!modulation.isNoteOn() && voice.age > 2.0f)
+        if (threadPool.getNumThreads() > 1 && numActiveGroups > 1 && numSamples >= minSamplesForThreads)
+        {
+            threadedNumSamples = numSamples;
+            threadPool.run (numActiveGroups, renderGroupTask, this);
+
+            for (int i = 0; i < numActiveGroups; ++i)
+                juce::FloatVectorOperations::add (output, groupBuffers.data() + i * maxBlockSize, numSamples);
+        }
+        else
+        {
+            auto& s = scratch.front();
+
+            for (int i = 0; i < numActiveGroups; ++i)
+            {
+                renderVoiceGroup (activeGroups[static_cast<size_t> (i)], s.group.data(), numSamples, s);
+                juce::FloatVectorOperations::add (output, s.group.data(), numSamples);
+            }
+        }
+
+        retireFinishedVoices();
+    }
+
+    static void renderGroupTask (void* context, int taskIndex, int threadIndex)
+    {
+        auto& self = *static_cast<GrowlProcessor*> (context);
+        self.renderVoiceGroup (self.activeGroups[static_cast<size_t> (taskIndex)],
+                               self.groupBuffers.data() + taskIndex * self.maxBlockSize,
+                               self.threadedNumSamples,
+                               self.scratch[static_cast<size_t> (threadIndex)]);
+    }
+
+    /**
+        Renders one group of voices into output (overwriting it). Only touches
+        the state of the voices in this group, so groups can render in parallel.
+    */
+    void renderVoiceGroup (int group, float* output, int numSamples, RenderScratch& s)
+    {
+        auto* voice = s.voice.data();
+        auto* osc = s.oscillator.data();
+        auto* lanes = s.lanes.data();
+        auto* interleaved = reinterpret_cast<float*> (lanes);
+        const int firstVoice = group * Pool::laneWidth;
+
+        juce::FloatVectorOperations::clear (output, numSamples);
+
+        // Pink noise is rendered for the whole group at once, one voice per
+        // lane, and each voice picks its lane up below
+        const bool noiseInLanes = ! useSharedNoiseTables && NoiseLanes<VoiceLanes>::supports (noiseType);
+
+        if (noiseInLanes)
+            pool.groupNoise[group].processBlock (lanes, numSamples);
+
+        // Excitation: each voice's noise blended with its own oscillator and
+        // shaped by its envelope, interleaved so that every sample holds one
+        // voice per lane. Enveloping before the formants lets them ring out
+        // naturally after the release.
+        for (int lane = 0; lane < Pool::laneWidth; ++lane)
+        {
+            const int v = firstVoice + lane;
+
+            if (pool.active[v])
+            {
+                if (noiseInLanes)
                 {
-                    voice.active = false;
+                    for (int i = 0; i < numSamples; ++i)
+                        voice[i] = interleaved[i * Pool::laneWidth + lane];
                 }
+                else
+                {
+                    pool.noise[v].processBlock (voice, numSamples);
+                }
+
+                pool.oscillators[v].processBlock (osc, numSamples);
+                juce::FloatVectorOperations::multiply (voice, 1.0f - oscillatorMix, numSamples);
+                juce::FloatVectorOperations::addWithMultiply (voice, osc, oscillatorMix, numSamples);
+                pool.envelopes[v].applyTo (voice, numSamples);
+            }
+            else
+            {
+                juce::FloatVectorOperations::clear (voice, numSamples);
             }
+
+            for (int i = 0; i < numSamples; ++i)
+                interleaved[i * Pool::laneWidth + lane] = voice[i];
         }
 
-        // Process modulation
-        modulation.process(numSamples);
+        // Formants and distortion for the whole group, one voice per lane,
+        // each stage running over the block in place
+        pool.resonance[group].processBlock (lanes, lanes, numSamples);
+        measureTails (group, lanes, numSamples);
+        pool.distortion[group].processBlock (lanes, lanes, numSamples);
+
+        // Mix-down, per voice
+        const auto blockSeconds = static_cast<float> (numSamples / sampleRate);
+
+        for (int lane = 0; lane < Pool::laneWidth; ++lane)
+        {
+            const int v = firstVoice + lane;
+
+            if (! pool.active[v])
+                continue;
+
+            for (int i = 0; i < numSamples; ++i)
+                voice[i] = interleaved[i * Pool::laneWidth + lane];
+
+            juce::FloatVectorOperations::addWithMultiply (output, voice, pool.velocity[v], numSamples);
+
+            // Level tracker for voice stealing and sleep: block peak of what this voice contributed
+            float peak = 0.0f;
+            for (int i = 0; i < numSamples; ++i)
+                peak = juce::jmax (peak, std::abs (voice[i]));
+
+            pool.level[v] = peak * pool.velocity[v];
+            pool.age[v] += blockSeconds;
+        }
     }
 
-    void reset()
+    /**
+        Measures the formant tail of every voice in the group whose envelope
+        has finished. This is taken before distortion, since a shaper with a
+        bias or a quantiser can keep a silent voice's output away from zero.
+    */
+    void measureTails (int group, const VoiceLanes* lanes, int numSamples) noexcept
     {
-        noise.reset();
-        resonance.reset();
-        distortion.reset();
-        modulation.reset();
+        using L = Lanes<VoiceLanes>;
+        const int firstVoice = group * Pool::laneWidth;
+        bool anyReleased = false;
+
+        for (int v = firstVoice; v < firstVoice + Pool::laneWidth; ++v)
+            anyReleased = anyReleased || (pool.active[v] && ! pool.envelopes[v].isActive());
+
+        if (! anyReleased)
+            return;
+
+        VoiceLanes peak (0.0f);
+
+        for (int i = 0; i < numSamples; ++i)
+            peak = L::max (peak, L::max (lanes[i], VoiceLanes (0.0f) - lanes[i]));
 
-        for (auto& voice : voices)
+        for (int lane = 0; lane < Pool::laneWidth; ++lane)
+            pool.tailLevel[firstVoice + lane] = L::get (peak, static_cast<size_t> (lane)) * pool.velocity[firstVoice + lane];
+    }
+
+    /**
+        Puts voices to sleep once their release has finished and the formant
+        tail has decayed below sleepThreshold, returning them to the allocator.
+        A sleeping voice is skipped entirely until it is retriggered. Only looks
+        at the groups rendered this block; runs on the audio thread only.
+    */
+    void retireFinishedVoices() noexcept
+    {
+        for (int i = 0; i < numActiveGroups; ++i)
         {
-            voice.active = false;
-            voice.age = 0.0f;
+            const int firstVoice = activeGroups[static_cast<size_t> (i)] * Pool::laneWidth;
+
+            for (int v = firstVoice; v < firstVoice + Pool::laneWidth; ++v)
+            {
+                if (pool.active[v] && ! pool.envelopes[v].isActive() && pool.tailLevel[v] < sleepThreshold)
+                {
+                    pool.active[v] = false;
+                    allocator.unmapNote (pool.noteNumber[v], v);
+                    allocator.release (v);
+                }
+            }
         }
     }
 
-private:
     //==============================================================================
-    NoiseGenerator noise;
-    OscillatorBank oscBank;
-    ResonanceSystem resonance;
-    DistortionStage distortion;
+    Pool pool;
+    VoiceAllocator<maxVoices> allocator;
     SizeScaler sizeScaler;
     ModulationSystem modulation;
 
-    static constexpr int maxVoices = 16;
-    Voice voices[maxVoices];
+    double sampleRate = 48000.0;
+    int maxBlockSize = 512;
+    float oscillatorMix = 0.5f;
+    NoiseGenerator::NoiseType noiseType = NoiseGenerator::White;
+    bool useSharedNoiseTables = false;
+
+    // Size tables for the current preset; see rebuildFormantTable()
+    std::array<FormantSizeTable, 2> formantTables;
+    FormantSizeTable* publishedFormantTable = nullptr;   // message thread only
+    std::atomic<const FormantSizeTable*> pendingFormantTable { nullptr };
+    float presetFormantFreqs[maxFormants] = { 200.0f, 440.0f, 800.0f, 1500.0f, 2500.0f, 3500.0f, 4500.0f, 5500.0f };
+    float presetFormantQs[maxFormants] = { 8.0f, 8.0f, 6.0f, 5.0f, 4.0f, 4.0f, 4.0f, 4.0f };
+    int presetNumFormants = 5;
+    float presetSizeFeet = 10.0f;   // SizeScaler's reference size
+
+    static_assert (PresetParameters::maxFormants == maxFormants, "Presets and filter banks must agree on the formant limit");
+
+    bool noiseTracksFirstFormant = false;
+    float firstFormantFrequency = NoiseGenerator::defaultBandpassCentre;
+    float firstFormantQ = NoiseGenerator::defaultBandpassQ;
+
+    std::vector<RenderScratch> scratch = std::vector<RenderScratch> (1);
+    std::vector<float> groupBuffers;
+    std::array<int, Pool::numGroups> activeGroups {};
+    int numActiveGroups = 0;
+
+    RenderThreadPool threadPool;
+    int numRenderThreads = 1;
+    int threadedNumSamples = 0;
+
+    int oversamplingFactorLog2 = 0;
+    OversamplingFilter oversamplingFilter = OversamplingFilter::MinimumPhase;
 
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GrowlProcessor)
@@ -14,6 +14,7 @@
 
 #include <juce_dsp/juce_dsp.h>
 #include <juce_audio_basics/juce_audio_basics.h>
+#include "FastMath.h"
 
 namespace Growl {
 namespace DSP {
@@ -30,6 +31,180 @@ struct LFO
     enum WaveformType { Sine = 0, Triangle = 1, SawUp = 2, SawDown = 3, Square = 4, SampleHold = 5, Noise = 6 };
 };
 
+//==============================================================================
+/**
+    Linear ADSR envelope.
+
+    GrowlProcessor owns one per voice and renders it sample by sample with
+    applyTo(); ModulationSystem owns a global one and advances it once per block.
+*/
+class Envelope
+{
+public:
+    enum Stage { Attack = 0, Decay = 1, Sustain = 2, Release = 3, Idle = 4 };
+
+    Envelope()
+    {
+        updateRates();
+    }
+
+    ~Envelope() = default;
+
+    void prepare (double sampleRate)
+    {
+        inverseSampleRate = 1.0f / static_cast<float> (sampleRate);
+        updateRates();
+    }
+
+    void setParameters (float attackSeconds, float decaySeconds, float sustainLevel, float releaseSeconds)
+    {
+        attack = juce::jmax (0.001f, attackSeconds);
+        decay = juce::jmax (0.001f, decaySeconds);
+        sustain = juce::jlimit (0.0f, 1.0f, sustainLevel);
+        release = juce::jmax (0.001f, releaseSeconds);
+        updateRates();
+    }
+
+    /** Starts the attack from the current level, so retriggering never jumps. */
+    void noteOn() noexcept
+    {
+        stage = Attack;
+    }
+
+    void noteOff() noexcept
+    {
+        if (stage != Idle)
+            stage = Release;
+    }
+
+    bool isActive() const noexcept      { return stage != Idle; }
+    bool isNoteOn() const noexcept      { return stage < Release; }
+    Stage getStage() const noexcept     { return stage; }
+    float getCurrentValue() const noexcept { return current; }
+
+    /** Advances the envelope by a whole block and returns the new level (control rate). */
+    float advance (int numSamples) noexcept
+    {
+        const auto n = static_cast<float> (numSamples);
+
+        switch (stage)
+        {
+            case Attack:
+                current += attackRate * n;
+                if (current >= 1.0f)
+                {
+                    current = 1.0f;
+                    stage = Decay;
+                }
+                break;
+
+            case Decay:
+                current -= decayRate * n;
+                if (current <= sustain)
+                {
+                    current = sustain;
+                    stage = Sustain;
+                }
+                break;
+
+            case Sustain:
+                current = sustain;
+                break;
+
+            case Release:
+                current -= releaseRate * n;
+                if (current <= 0.0f)
+                {
+                    current = 0.0f;
+                    stage = Idle;
+                }
+                break;
+
+            case Idle:
+                current = 0.0f;
+                break;
+        }
+
+        return current;
+    }
+
+    /** Multiplies a buffer by the envelope, advancing it one sample at a time. */
+    void applyTo (float* buffer, int numSamples) noexcept
+    {
+        int i = 0;
+
+        while (i < numSamples)
+        {
+            if (stage == Sustain)
+            {
+                juce::FloatVectorOperations::multiply (buffer + i, sustain, numSamples - i);
+                return;
+            }
+
+            if (stage == Idle)
+            {
+                juce::FloatVectorOperations::clear (buffer + i, numSamples - i);
+                return;
+            }
+
+            // Attack, decay and release are linear ramps: render up to the end
+            // of the current segment, then move on to the next stage.
+            const auto delta = stage == Attack ? attackRate : (stage == Decay ? -decayRate : -releaseRate);
+            const auto target = stage == Attack ? 1.0f : (stage == Decay ? sustain : 0.0f);
+            const auto stepsToTarget = delta != 0.0f ? std::ceil ((target - current) / delta) : 0.0f;
+            const auto n = static_cast<int> (juce::jlimit (0.0f, static_cast<float> (numSamples - i), stepsToTarget));
+
+            // Local copy: the buffer could alias the member, which would force a store per sample
+            auto level = current;
+
+            for (int k = 0; k < n; ++k)
+            {
+                level += delta;
+                buffer[i + k] *= level;
+            }
+
+            current = level;
+            i += n;
+
+            if (static_cast<float> (n) >= stepsToTarget)
+            {
+                current = target;
+                stage = stage == Attack ? Decay : (stage == Decay ? Sustain : Idle);
+            }
+        }
+    }
+
+    void reset() noexcept
+    {
+        current = 0.0f;
+        stage = Idle;
+    }
+
+private:
+    //==============================================================================
+    void updateRates() noexcept
+    {
+        attackRate = inverseSampleRate / attack;
+        decayRate = inverseSampleRate / decay * (1.0f - sustain);
+        releaseRate = inverseSampleRate / release * sustain;
+    }
+
+    //==============================================================================
+    float attack = 0.01f;
+    float decay = 0.1f;
+    float sustain = 0.7f;
+    float release = 0.2f;
+    float inverseSampleRate = 1.0f / 44100.0f;
+    float attackRate = 0.0f;
+    float decayRate = 0.0f;
+    float releaseRate = 0.0f;
+    float current = 0.0f;
+    Stage stage = Idle;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Envelope)
+};
+
 class ModulationSystem
 {
 public:
@@ -52,6 +227,7 @@ public:
     {
         sampleRate = sr;
         inverseSampleRate = 1.0f / static_cast<float>(sampleRate);
+        envelope.prepare (sampleRate);
     }
 
     void setLFORate (int lfoIndex, float rateHz)
@@ -62,14 +238,17 @@ public:
 
     void noteOn()
     {
-        envStage = 0; // Attack
-        envPhase = 0.0f;
+        envelope.noteOn();
     }
 
     void noteOff()
     {
-        envStage = 3; // Release
-        envPhase = 0.0f;
+        envelope.noteOff();
+    }
+
+    bool isNoteOn() const
+    {
+        return envelope.isNoteOn();
     }
 
     float getLFOOutput (int lfoIndex) const
@@ -81,7 +260,7 @@ public:
 
     float getEnvelopeOutput() const
     {
-        return envCurrent;
+        return envelope.getCurrentValue();
     }
 
     void process (int numSamples)
@@ -95,11 +274,11 @@ public:
                 lfo.phase -= 1.0f;
 
             // Generate sine wave
-            lfo.output = std::sin(lfo.phase * juce::MathConstants<float>::twoPi) * lfo.depth;
+            lfo.output = FastMath::sin(lfo.phase * juce::MathConstants<float>::twoPi) * lfo.depth;
         }
 
         // Process envelope (simplified ADSR)
-        processEnvelope(numSamples);
+        envelope.advance (numSamples);
     }
 
     void reset()
@@ -109,72 +288,15 @@ public:
             lfo.phase = 0.0f;
             lfo.output = 0.0f;
         }
-        envCurrent = 0.0f;
-        envStage = 4; // Idle
+        envelope.reset();
     }
 
 private:
-    //==============================================================================
-    void processEnvelope (int numSamples)
-    {
-        float attack = 0.01f;
-        float decay = 0.1f;
-        float sustain = 0.7f;
-        float release = 0.2f;
-
-        float increment = 0.0f;
-
-        switch (envStage)
-        {
-            case 0: // Attack
-                increment = static_cast<float>(numSamples * inverseSampleRate) / attack;
-                envCurrent += increment;
-                if (envCurrent >= 1.0f)
-                {
-                    envCurrent = 1.0f;
-                    envStage = 1;
-                }
-                break;
-
-            case 1: // Decay
-                increment = static_cast<float>(numSamples * inverseSampleRate) / decay;
-                envCurrent -= increment * (1.0f - sustain);
-                if (envCurrent <= sustain)
-                {
-                    envCurrent = sustain;
-                    envStage = 2;
-                }
-                break;
-
-            case 2: // Sustain
-                envCurrent = sustain;
-                break;
-
-            case 3: // Release
-                increment = static_cast<float>(numSamples * inverseSampleRate) / release;
-                envCurrent -= increment * sustain;
-                if (envCurrent <= 0.0f)
-                {
-                    envCurrent = 0.0f;
-                    envStage = 4;
-                }
-                break;
-
-            case 4: // Idle
-                envCurrent = 0.0f;
-                break;
-        }
-
-        envCurrent = juce::jlimit(0.0f, 1.0f, envCurrent);
-    }
-
     //==============================================================================
     std::array<LFO, 4> lfos;
     double sampleRate = 44100.0;
     float inverseSampleRate = 1.0f / 44100.0f;
-    float envCurrent = 0.0f;
-    float envPhase = 0.0f;
-    int envStage = 4;
+    Envelope envelope;
 
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ModulationSystem)
@@ -7,6 +7,7 @@
 
     Noise generation for animal vocal synthesis.
     Implements 6 noise types: White, Pink, Brown, Bandpass, PinkMixed, CustomMix.
+    Pink and PinkMixed can also run for a group of voices in SIMD lanes.
 
   ==============================================================================
 */
@@ -15,10 +16,112 @@
 
 #include <juce_dsp/juce_dsp.h>
 #include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <bit>
+#include <vector>
+#include "RandomLanes.h"
+#include "FastMath.h"
 
 namespace Growl {
 namespace DSP {
 
+//==============================================================================
+/**
+    Voss-McCartney pink noise with Gardner's extra white term: numRows
+    held white values, where row r is redrawn every 2^(r+1) samples. The
+    row to redraw is the number of trailing zeros of a running counter,
+    so each sample touches exactly one row and keeps a running sum; the
+    result follows -3 dB/octave from about 1 Hz up to Nyquist at 48 kHz.
+
+    SampleType is either float or a SIMD register holding one independent
+    stream per lane. The lanes share the counter, so picking the row costs
+    the same for a whole register as for one stream, and every row update
+    is a single vector operation.
+*/
+template <typename SampleType>
+class PinkNoise
+{
+public:
+    static constexpr int numRows = 16;
+    static constexpr int numLanes = static_cast<int> (Lanes<SampleType>::size);
+
+    PinkNoise()
+    {
+        reset();
+    }
+
+    inline SampleType process (RandomLanes& random) noexcept
+    {
+        alignas (cacheLineSize) float draws[2 * numLanes];
+
+        for (auto& d : draws)
+            d = random.next();
+
+        return advance (Lanes<SampleType>::load (draws), Lanes<SampleType>::load (draws + numLanes), runningSum, counter);
+    }
+
+    /** Draws the white values for a chunk at a time with RandomLanes::fill; the same sequence as process(). */
+    void processBlock (SampleType* output, int numSamples, RandomLanes& random) noexcept
+    {
+        alignas (cacheLineSize) float draws[2 * chunkSize * numLanes];
+
+        // Locals, so that stores to output cannot force the running sum back through memory
+        SampleType sum = runningSum;
+        uint32_t count = counter;
+
+        for (int start = 0; start < numSamples; start += chunkSize)
+        {
+            const int n = juce::jmin (chunkSize, numSamples - start);
+            random.fill (draws, 2 * n * numLanes);
+
+            for (int i = 0; i < n; ++i)
+            {
+                const float* d = draws + 2 * i * numLanes;
+                output[start + i] = advance (Lanes<SampleType>::load (d), Lanes<SampleType>::load (d + numLanes), sum, count);
+            }
+        }
+
+        runningSum = sum;
+        counter = count;
+    }
+
+    void reset() noexcept
+    {
+        for (auto& r : rows) r = SampleType (0.0f);
+        runningSum = SampleType (0.0f);
+        counter = 0;
+    }
+
+private:
+    // 64 samples of one stream, or fewer samples of several
+    static constexpr int chunkSize = 64 / numLanes;
+
+    // Scales the sum of numRows + 1 uniform values so that 3 sigma sits at full scale
+    static constexpr float outputScale = 0.1400280084f;   // 1 / sqrt (3 * (numRows + 1))
+
+    inline SampleType advance (SampleType row, SampleType white, SampleType& sum, uint32_t& count) noexcept
+    {
+        // Counter values 1, 2, 3, 4... redraw rows 0, 1, 0, 2...; a wrap to zero redraws the slowest row
+        const int index = juce::jmin (std::countr_zero (++count), numRows - 1);
+        sum += row - rows[index];
+        rows[index] = row;
+
+        // Re-add from scratch once per slowest-row period so rounding in the running sum cannot drift
+        if (index == numRows - 1)
+        {
+            sum = SampleType (0.0f);
+            for (auto r : rows) sum += r;
+        }
+
+        return Lanes<SampleType>::clamp ((sum + white) * outputScale, -1.0f, 1.0f);
+    }
+
+    SampleType rows[numRows];
+    SampleType runningSum;
+    uint32_t counter;
+};
+
+//==============================================================================
 class NoiseGenerator
 {
 public:
@@ -32,6 +135,10 @@ public:
         CustomMix = 5
     };
 
+    // The original voice band, 300-3000 Hz: geometric centre and the Q of a 3.3 octave bandwidth
+    static constexpr float defaultBandpassCentre = 948.7f;
+    static constexpr float defaultBandpassQ = 0.351f;
+
     NoiseGenerator()
         : noiseType(White)
     {
@@ -39,152 +146,532 @@ public:
 
     ~NoiseGenerator() = default;
 
+    /** Needed for the band-pass type, whose band is set in Hz. */
+    void prepare (double sampleRate)
+    {
+        bandpassNoise.prepare (sampleRate);
+    }
+
     void setNoiseType (NoiseType type)
     {
         noiseType = type;
     }
 
+    /**
+        Centre (Hz) and Q of the band-pass type, e.g. to follow the first
+        formant. The coefficients are recomputed only when these change.
+    */
+    void setBandpassBand (float centreHz, float q = defaultBandpassQ)
+    {
+        bandpassNoise.setBand (centreHz, q);
+    }
+
+    /** Weights of the white, pink and brown generators in CustomMix; a zero weight skips that generator. */
+    void setMixWeights (float white, float pink, float brown)
+    {
+        customWeights = { juce::jmax (0.0f, white), juce::jmax (0.0f, pink), juce::jmax (0.0f, brown) };
+    }
+
+    /** Gives each instance its own sequence so polyphonic voices stay decorrelated. */
+    void setSeed (uint32_t seed)
+    {
+        random.setSeed (seed);
+
+        // The seed also picks this instance's start and stride in the shared tables
+        uint32_t hash = seed * 0x9E3779B9u;
+        hash = (hash ^ (hash >> 16)) * 0x85EBCA6Bu;
+        hash ^= hash >> 13;
+
+        tableStart = hash;
+        tableStride = ((hash >> 18) & 0x6u) | 1u;   // 1, 3, 5 or 7: short enough to stay cache friendly
+        tableDirection = (hash & 0x20000u) != 0 ? 1u : ~0u;   // +1 or -1
+        tablePosition = tableStart;
+    }
+
+    /**
+        Reads noise from long precomputed tables shared by every instance,
+        instead of generating it. Each instance starts at an offset picked by
+        its seed: White reads with an odd stride picked by the seed (Bandpass
+        filters that same read), and the other coloured types read forwards
+        or backwards one step at a time, which keeps their spectrum. Noise
+        then costs one load per sample and no memory per instance. The tables
+        are built on the first call, so call this from the message thread.
+    */
+    void setUseSharedTables (bool shouldUseTables)
+    {
+        tables = shouldUseTables ? &NoiseTables::get() : nullptr;
+    }
+
     float process() noexcept
     {
+        if (tables != nullptr)
+            return processFromTables();
+
         switch (noiseType)
         {
-            case White: return whiteNoise.process();
-            case Pink: return pinkNoise.process();
-            case Brown: return brownNoise.process();
-            case Bandpass: return bandpassNoise.process();
-            case PinkMixed: return (pinkNoise.process() * 0.7f + whiteNoise.process() * 0.3f);
-            case CustomMix: return (whiteNoise.process() * 0.5f + pinkNoise.process() * 0.3f + brownNoise.process() * 0.2f);
-            default: return whiteNoise.process();
+            case White: return random.next();
+            case Pink: return pinkNoise.process (random);
+            case Brown: return brownNoise.process (random);
+            case Bandpass: return bandpassNoise.process (random);
+            case PinkMixed: return processMix (pinkMixedWeights);
+            case CustomMix: return processMix (customWeights);
+            default: return random.next();
         }
     }
 
+    /**
+        Fills a whole buffer with one kernel per noise type, chosen once per block.
+        The single-colour kernels draw a block of white noise and filter it in
+        place; the mixes render each generator with a non-zero weight into a
+        chunk and accumulate, so a mix costs only the generators it uses. Mixes
+        draw their random numbers generator by generator, so they are
+        reproducible per seed but not sample-identical to process().
+    */
     void processBlock (float* output, int numSamples) noexcept
     {
-        for (int i = 0; i < numSamples; ++i)
-            output[i] = process();
+        if (tables != nullptr)
+        {
+            processBlockFromTables (output, numSamples);
+            return;
+        }
+
+        switch (noiseType)
+        {
+            case Pink:      pinkNoise.processBlock (output, numSamples, random); break;
+            case Brown:     brownNoise.processBlock (output, numSamples, random); break;
+            case Bandpass:  bandpassNoise.processBlock (output, numSamples, random); break;
+            case PinkMixed: processMixBlock (output, numSamples, pinkMixedWeights); break;
+            case CustomMix: processMixBlock (output, numSamples, customWeights); break;
+            case White:
+            default:        random.fill (output, numSamples); break;
+        }
     }
 
     void reset() noexcept
     {
-        whiteNoise.reset();
+        random.reset();
+        tablePosition = tableStart;
         pinkNoise.reset();
         brownNoise.reset();
         bandpassNoise.reset();
     }
 
+    /** Generator weights of a mix type. */
+    struct MixWeights
+    {
+        float white, pink, brown;
+    };
+
+    static constexpr MixWeights pinkMixedWeights { 0.3f, 0.7f, 0.0f };
+
 private:
     //==============================================================================
-    class WhiteNoise
+    static constexpr int mixChunkSize = 64;
+
+    float processMix (const MixWeights& weights) noexcept
     {
-    public:
-        WhiteNoise() : state(123456789) {}
+        float output = 0.0f;
+
+        if (weights.white > 0.0f)  output += random.next() * weights.white;
+        if (weights.pink > 0.0f)   output += pinkNoise.process (random) * weights.pink;
+        if (weights.brown > 0.0f)  output += brownNoise.process (random) * weights.brown;
+
+        return output;
+    }
+
+    void processMixBlock (float* output, int numSamples, const MixWeights& weights) noexcept
+    {
+        float scratch[mixChunkSize];
 
-        inline float process() noexcept
+        for (int start = 0; start < numSamples; start += mixChunkSize)
         {
-            state ^= state << 13;
-            state ^= state >> 17;
-            state ^= state << 5;
-            return (float)(state & 0x7FFFFFFF) / (float)0x7FFFFFFF * 2.0f - 1.0f;
-        }
+            const int n = juce::jmin (mixChunkSize, numSamples - start);
+            float* out = output + start;
 
-        void reset() noexcept { state = 123456789; }
+            juce::FloatVectorOperations::clear (out, n);
 
-    private:
-        uint32_t state;
-    };
+            if (weights.white > 0.0f)
+            {
+                random.fill (scratch, n);
+                juce::FloatVectorOperations::addWithMultiply (out, scratch, weights.white, n);
+            }
+
+            if (weights.pink > 0.0f)
+            {
+                pinkNoise.processBlock (scratch, n, random);
+                juce::FloatVectorOperations::addWithMultiply (out, scratch, weights.pink, n);
+            }
+
+            if (weights.brown > 0.0f)
+            {
+                brownNoise.processBlock (scratch, n, random);
+                juce::FloatVectorOperations::addWithMultiply (out, scratch, weights.brown, n);
+            }
+        }
+    }
 
-    class PinkNoise
+    //==============================================================================
+    /**
+        One table per colour (white, pink and brown; band-pass filters the
+        white table at the prepared rate), each a seamless loop of tableSize samples from
+        the generators below with fixed seeds. Every table is generated with
+        a different seed, so mixes of them stay decorrelated, and the loop
+        seam is an equal-power crossfade from the end of the render into its
+        start. Shared read-only by every instance in the process.
+    */
+    struct NoiseTables
     {
-    public:
-        PinkNoise()
+        static constexpr uint32_t tableSize = 1u << 17;   // 2.7 s at 48 kHz, 512 KB per colour
+        static constexpr uint32_t tableMask = tableSize - 1;
+        static constexpr int crossfadeLength = 4096;
+
+        static const NoiseTables& get()
+        {
+            static const NoiseTables instance;
+            return instance;
+        }
+
+        const float* getTable (NoiseType type) const noexcept
         {
-            for (auto& s : state) s = 0;
-            counter = 0;
+            return tables[static_cast<size_t> (type)].data();
         }
 
-        inline float process() noexcept
+    private:
+        NoiseTables()
         {
-            counter++;
-            int roll = counter % 5;
+            std::vector<float> render (tableSize + crossfadeLength);
 
-            for (int i = 0; i < 5; ++i)
+            for (auto type : { White, Pink, Brown })
             {
-                if (roll % 2 == 1)
+                NoiseGenerator generator;
+                generator.setNoiseType (type);
+                generator.setSeed (0x7ab1e5u + static_cast<uint32_t> (type) * 0x9E3779B9u);
+                generator.processBlock (render.data(), static_cast<int> (render.size()));
+
+                auto& table = tables[static_cast<size_t> (type)];
+                table.assign (render.begin(), render.begin() + tableSize);
+
+                // The table ends where render[tableSize] would follow, so fade that continuation into the start
+                for (int i = 0; i < crossfadeLength; ++i)
                 {
-                    state[i] -= (state[i] >> 1);
-                    state[i] += (rand() & 0x7FFFFFFF) >> 1;
+                    const float fadeIn = static_cast<float> (i) / static_cast<float> (crossfadeLength);
+                    const auto index = static_cast<size_t> (i);
+                    table[index] = render[index] * std::sqrt (fadeIn) + render[tableSize + index] * std::sqrt (1.0f - fadeIn);
                 }
-                roll >>= 1;
+            }
+        }
+
+        std::array<std::vector<float>, 3> tables;
+    };
+
+    float processFromTables() noexcept
+    {
+        const auto read = [this] (NoiseType type)
+        {
+            return tables->getTable (type)[tablePosition & NoiseTables::tableMask];
+        };
+
+        float output = 0.0f;
+
+        switch (noiseType)
+        {
+            case Pink:
+            case Brown:
+                output = read (noiseType);
+                tablePosition += tableDirection;
+                return output;
+
+            case Bandpass:
+                output = bandpassNoise.filterSample (read (White));
+                tablePosition += tableStride;
+                return output;
+
+            case PinkMixed:
+            case CustomMix:
+            {
+                // One shared position keeps the colours of a mix in step; the tables themselves are independent
+                const auto& weights = noiseType == PinkMixed ? pinkMixedWeights : customWeights;
+                output = read (White) * weights.white + read (Pink) * weights.pink + read (Brown) * weights.brown;
+                tablePosition += tableDirection;
+                return output;
             }
 
-            float sum = state[0] + state[1] + state[2] + state[3] + state[4];
-            return sum / 161430000.0f * 2.0f - 1.0f;
+            case White:
+            default:
+                output = read (White);
+                tablePosition += tableStride;
+                return output;
         }
+    }
 
-        void reset() noexcept
+    void processBlockFromTables (float* output, int numSamples) noexcept
+    {
+        const auto readTable = [this, numSamples] (float* out, NoiseType type, uint32_t stride, float gain, bool accumulate)
         {
-            for (auto& s : state) s = 0;
-            counter = 0;
+            const float* table = tables->getTable (type);
+            uint32_t position = tablePosition;
+
+            for (int i = 0; i < numSamples; ++i, position += stride)
+            {
+                const float value = table[position & NoiseTables::tableMask] * gain;
+                out[i] = accumulate ? out[i] + value : value;
+            }
+        };
+
+        switch (noiseType)
+        {
+            case Pink:
+            case Brown:
+                readTable (output, noiseType, tableDirection, 1.0f, false);
+                tablePosition += tableDirection * static_cast<uint32_t> (numSamples);
+                break;
+
+            case Bandpass:
+                readTable (output, White, tableStride, 1.0f, false);
+                tablePosition += tableStride * static_cast<uint32_t> (numSamples);
+                bandpassNoise.filterBlock (output, numSamples);
+                break;
+
+            case PinkMixed:
+            case CustomMix:
+            {
+                const auto& weights = noiseType == PinkMixed ? pinkMixedWeights : customWeights;
+                juce::FloatVectorOperations::clear (output, numSamples);
+
+                if (weights.white > 0.0f)  readTable (output, White, tableDirection, weights.white, true);
+                if (weights.pink > 0.0f)   readTable (output, Pink, tableDirection, weights.pink, true);
+                if (weights.brown > 0.0f)  readTable (output, Brown, tableDirection, weights.brown, true);
+
+                tablePosition += tableDirection * static_cast<uint32_t> (numSamples);
+                break;
+            }
+
+            case White:
+            default:
+                readTable (output, White, tableStride, 1.0f, false);
+                tablePosition += tableStride * static_cast<uint32_t> (numSamples);
+                break;
         }
+    }
 
-    private:
-        int state[5];
-        int counter;
-    };
+    //==============================================================================
+    // The coloured generators draw their white input from the instance's own
+    // RandomLanes, so nothing here touches global state.
 
     class BrownNoise
     {
     public:
         BrownNoise() : lastValue(0.0f) {}
 
-        inline float process() noexcept
+        inline float process (RandomLanes& random) noexcept
         {
-            float white = (float)(rand() & 0x7FFFFFFF) / (float)0x7FFFFFFF * 2.0f - 1.0f;
-            lastValue = (lastValue + (0.02f * white)) / 1.02f;
-            lastValue = juce::jlimit (-1.0f, 1.0f, lastValue);
-            return lastValue;
+            return integrate (random.next());
+        }
+
+        /** Draws a block of white noise and integrates it in place. */
+        void processBlock (float* output, int numSamples, RandomLanes& random) noexcept
+        {
+            random.fill (output, numSamples);
+
+            for (int i = 0; i < numSamples; ++i)
+                output[i] = integrate (output[i]);
         }
 
         void reset() noexcept { lastValue = 0.0f; }
 
     private:
+        inline float integrate (float white) noexcept
+        {
+            // Leaky integrator: (y + 0.02 w) / 1.02
+            lastValue = lastValue * (1.0f / 1.02f) + white * (0.02f / 1.02f);
+            lastValue = juce::jlimit (-1.0f, 1.0f, lastValue);
+            return lastValue;
+        }
+
         float lastValue;
     };
 
+    /**
+        White noise through one band-pass biquad (RBJ, 0 dB peak), in
+        transposed direct form II. The coefficients are worked out in Hz
+        against the prepared sample rate, and only when the band changes,
+        so the band sits in the same place at any host rate. A make-up gain
+        folded into the numerator keeps the output level independent of the
+        bandwidth, with 3 sigma at full scale like the pink generator.
+    */
     class BandpassNoise
     {
     public:
-        BandpassNoise() : x1(0.0f), x2(0.0f), y1(0.0f), y2(0.0f) {}
+        BandpassNoise()
+        {
+            updateCoefficients();
+        }
 
-        inline float process() noexcept
+        void prepare (double newSampleRate)
         {
-            float input = (float)(rand() & 0x7FFFFFFF) / (float)0x7FFFFFFF * 2.0f - 1.0f;
+            sampleRate = newSampleRate;
+            updateCoefficients();
+        }
 
-            // Simple bandpass filter (300-3000 Hz for vocal range)
-            float output = 0.5f * input - 0.5f * x2 + 0.95f * y1;
-            x2 = x1;
-            x1 = input;
-            y1 = output;
+        void setBand (float newCentreHz, float newQ)
+        {
+            if (newCentreHz != centre || newQ != q)
+            {
+                centre = newCentreHz;
+                q = newQ;
+                updateCoefficients();
+            }
+        }
 
-            return juce::jlimit (-1.0f, 1.0f, output);
+        inline float process (RandomLanes& random) noexcept
+        {
+            return filterSample (random.next());
         }
 
-        void reset() noexcept { x1 = x2 = y1 = y2 = 0.0f; }
+        inline float filterSample (float input) noexcept
+        {
+            return filter (input, s1, s2);
+        }
+
+        /** Draws a block of white noise and filters it in place. */
+        void processBlock (float* output, int numSamples, RandomLanes& random) noexcept
+        {
+            random.fill (output, numSamples);
+            filterBlock (output, numSamples);
+        }
+
+        /** Filters a block of white noise in place. */
+        void filterBlock (float* buffer, int numSamples) noexcept
+        {
+            float z1 = s1, z2 = s2;
+
+            for (int i = 0; i < numSamples; ++i)
+                buffer[i] = filter (buffer[i], z1, z2);
+
+            s1 = z1;
+            s2 = z2;
+        }
+
+        void reset() noexcept { s1 = s2 = 0.0f; }
 
     private:
-        float x1, x2, y1, y2;
+        inline float filter (float input, float& z1, float& z2) const noexcept
+        {
+            // b1 is zero and b2 = -b0 for a band-pass
+            const float output = input * b0 + z1;
+            z1 = z2 - a1 * output;
+            z2 = -b0 * input - a2 * output;
+
+            return juce::jlimit (-1.0f, 1.0f, output);
+        }
+
+        void updateCoefficients() noexcept
+        {
+            const float nyquist = static_cast<float> (sampleRate) * 0.5f;
+            const float f0 = juce::jlimit (20.0f, nyquist * 0.9f, centre);
+            const float bandQ = juce::jlimit (0.1f, 20.0f, q);
+
+            const float omega = juce::MathConstants<float>::twoPi * f0 / static_cast<float> (sampleRate);
+            const float alpha = FastMath::sin (omega) / (2.0f * bandQ);
+            const float a0 = 1.0f + alpha;
+
+            // White noise through a resonance of bandwidth f0 / Q keeps about (pi / 2) (f0 / Q) / nyquist
+            // of its power; uniform noise has an RMS of 1 / sqrt (3) and the target is 1 / 3
+            const float noiseBandwidth = juce::MathConstants<float>::halfPi * f0 / bandQ;
+            const float makeUp = std::sqrt (nyquist / noiseBandwidth) * 0.5773503f;
+
+            b0 = alpha / a0 * makeUp;
+            a1 = -2.0f * FastMath::cos (omega) / a0;
+            a2 = (1.0f - alpha) / a0;
+        }
+
+        double sampleRate = 48000.0;
+        float centre = defaultBandpassCentre, q = defaultBandpassQ;
+        float b0 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+        float s1 = 0.0f, s2 = 0.0f;
     };
 
     //==============================================================================
-    WhiteNoise whiteNoise;
-    PinkNoise pinkNoise;
+    RandomLanes random;
+    PinkNoise<float> pinkNoise;
     BrownNoise brownNoise;
     BandpassNoise bandpassNoise;
     NoiseType noiseType;
+    MixWeights customWeights { 0.5f, 0.3f, 0.2f };
+
+    const NoiseTables* tables = nullptr;
+    uint32_t tableStart = 0, tablePosition = 0, tableStride = 1, tableDirection = 1;
 
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NoiseGenerator)
 };
 
+//==============================================================================
+/**
+    Pink and PinkMixed noise for a group of voices, one voice per SIMD lane,
+    packed the way VoicePool packs formants and distortion. Each lane has its
+    own Voss-McCartney rows and white draws, so voices stay decorrelated,
+    while the row bookkeeping is paid once per group instead of per voice.
+    The other types, and the shared tables, stay with the per-voice
+    NoiseGenerator.
+*/
+template <typename SampleType>
+class NoiseLanes
+{
+public:
+    static constexpr int numLanes = PinkNoise<SampleType>::numLanes;
+
+    /** True for the types this class renders. */
+    static bool supports (NoiseGenerator::NoiseType type) noexcept
+    {
+        return type == NoiseGenerator::Pink || type == NoiseGenerator::PinkMixed;
+    }
+
+    /** Types supports() rejects render as Pink. */
+    void setNoiseType (NoiseGenerator::NoiseType type) noexcept
+    {
+        noiseType = type;
+    }
+
+    void setSeed (uint32_t seed) noexcept
+    {
+        random.setSeed (seed);
+    }
+
+    /** Fills numSamples registers, one voice per lane. */
+    void processBlock (SampleType* output, int numSamples) noexcept
+    {
+        pinkNoise.processBlock (output, numSamples, random);
+
+        if (noiseType != NoiseGenerator::PinkMixed)
+            return;
+
+        constexpr auto weights = NoiseGenerator::pinkMixedWeights;
+        alignas (cacheLineSize) float white[chunkSize * numLanes];
+
+        for (int start = 0; start < numSamples; start += chunkSize)
+        {
+            const int n = juce::jmin (chunkSize, numSamples - start);
+            random.fill (white, n * numLanes);
+
+            for (int i = 0; i < n; ++i)
+                output[start + i] = output[start + i] * weights.pink + Lanes<SampleType>::load (white + i * numLanes) * weights.white;
+        }
+    }
+
+    void reset() noexcept
+    {
+        random.reset();
+        pinkNoise.reset();
+    }
+
+private:
+    static constexpr int chunkSize = 64 / numLanes;
+
+    RandomLanes random;
+    PinkNoise<SampleType> pinkNoise;
+    NoiseGenerator::NoiseType noiseType = NoiseGenerator::Pink;
+};
+
 } // namespace DSP
 } // namespace Growl
@@ -15,13 +15,17 @@
 
 #include <juce_dsp/juce_dsp.h>
 #include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
 #include <random>
+#include <utility>
 #include <vector>
+#include "SIMDLanes.h"
+#include "FastMath.h"
 
 namespace Growl {
 namespace DSP {
 
-class OscillatorBank
+class alignas (cacheLineSize) OscillatorBank
 {
 public:
     enum OscillatorType
@@ -32,6 +36,16 @@ public:
         Detuned = 3      // Detuned sawtooth bank
     };
 
+    /** Waveform drawn by the PolyBLEP oscillator: steps get a BLEP, corners a BLAMP. */
+    enum class PolyBLEPWaveform
+    {
+        Saw,
+        Square,
+        Triangle
+    };
+
+    static constexpr int maxUnisonVoices = 16;
+
     OscillatorBank()
         : oscType(DPW),
           sampleRate(48000.0),
@@ -40,10 +54,23 @@ public:
           detuneAmount(0.0f),
           numVoices(4)
     {
+        updateIncrements();
     }
 
     ~OscillatorBank() = default;
 
+    void prepare (double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        updateIncrements();
+    }
+
+    /** Seeds the unison phase randomisation, so every instance can start differently. */
+    void setSeed (uint32_t seed)
+    {
+        random.setSeed (static_cast<juce::int64> (seed));
+    }
+
     void setOscillatorType (OscillatorType type)
     {
         oscType = type;
@@ -52,134 +79,546 @@ public:
     void setFrequency (float freq)
     {
         frequency = juce::jlimit (20.0f, 20000.0f, freq);
+        updateIncrements();
     }
 
+    /** Polynomial order of the DPW sawtooth: 2 is cheapest, 3 suppresses aliasing further. */
+    void setDPWOrder (int order)
+    {
+        dpwOrder = juce::jlimit (2, 3, order);
+        updateIncrements();
+    }
+
+    void setPolyBLEPWaveform (PolyBLEPWaveform waveform)
+    {
+        polyBLEPWaveform = waveform;
+    }
+
+    /** Spread of the unison voices in cents: the outer voices sit at +/- detune. */
     void setDetune (float detune)
     {
         detuneAmount = juce::jlimit (-100.0f, 100.0f, detune);
+        updateUnison();
     }
 
     void setNumVoices (int voices)
     {
-        numVoices = juce::jlimit (1, 16, voices);
+        numVoices = juce::jlimit (1, maxUnisonVoices, voices);
+        updateUnison();
     }
 
     float process() noexcept
     {
-        switch (oscType)
-        {
-            case DPW: return processDPW();
-            case PolyBLEP: return processPolyBLEP();
-            case Wavetable: return processWavetable();
-            case Detuned: return processDetuned();
-            default: return processDPW();
-        }
+        float sample;
+        renderBlock (&sample, 1, FixedPitch { phaseIncrement });
+        return sample;
     }
 
+    /** Fills a whole buffer; the oscillator type is resolved once per block rather than per sample. */
     void processBlock (float* output, int numSamples) noexcept
     {
-        for (int i = 0; i < numSamples; ++i)
-            output[i] = process();
+        if (numSamples > 0)
+            renderBlock (output, numSamples, FixedPitch { phaseIncrement });
+    }
+
+    /**
+        Fills a buffer whose pitch follows phaseIncrements, one per sample in cycles
+        per sample (frequency / sample rate), so vibrato, bends and FM run at audio
+        rate. The frequency from setFrequency() is ignored for this block; unison
+        voices keep their detune ratio to each increment.
+    */
+    void processBlock (float* output, const float* phaseIncrements, int numSamples) noexcept
+    {
+        if (numSamples > 0)
+            renderBlock (output, numSamples, ModulatedPitch { phaseIncrements });
     }
 
     void reset() noexcept
     {
         phase = 0.0f;
+
+        // Random start phases, so a unison stack doesn't begin as one summed spike
+        for (int i = 0; i < maxUnisonVoices; ++i)
+            UnisonLanes::set (unisonPhases[static_cast<size_t> (i) / unisonLaneWidth], static_cast<size_t> (i) % unisonLaneWidth,
+                              i < numVoices ? random.nextFloat() : 0.0f);
     }
 
 private:
     //==============================================================================
-    float processDPW() noexcept
+    // Lowest modulated increment: keeps the DPW gain finite
+    static constexpr float minimumIncrement = 1.0e-4f;
+
+    /** Pitch sources for the block kernels: one fixed increment, or one per sample. */
+    struct FixedPitch
     {
-        // Differentiated Parabolic Waveform - bandlimited sawtooth
-        float t = phase;
-        float saw = 2.0f * t - 1.0f;
-        float dpw = saw - saw * saw; // Parabolic transform
+        static constexpr bool isModulated = false;
+        float increment;
+
+        float operator[] (int) const noexcept       { return increment; }
+        float getMaximum (int) const noexcept       { return increment; }
+
+        template <typename SampleType>
+        SampleType get (int) const noexcept         { return SampleType (increment); }
+
+        template <typename SampleType>
+        SampleType leadIn (int) const noexcept      { return Lanes<SampleType>::laneIndices() * increment; }
+    };
+
+    struct ModulatedPitch
+    {
+        static constexpr bool isModulated = true;
+        const float* increments;
+
+        float operator[] (int i) const noexcept     { return juce::jlimit (minimumIncrement, 0.5f, increments[i]); }
+
+        float getMaximum (int numSamples) const noexcept
+        {
+            // A register of running maxima, so the compares don't wait on each other
+            using L = Lanes<VoiceLanes>;
+            constexpr int width = static_cast<int> (L::size);
+            auto maxima = VoiceLanes::expand (minimumIncrement);
+            int i = 0;
+
+            for (; i + width <= numSamples; i += width)
+                maxima = L::max (maxima, L::loadUnaligned (increments + i));
 
-        // Differentiate (simple difference)
-        static float lastSample = 0.0f;
-        float output = dpw - lastSample;
-        lastSample = dpw;
+            float maximum = minimumIncrement;
 
-        // Update phase
-        phase += frequency / static_cast<float>(sampleRate);
-        if (phase >= 1.0f) phase -= 1.0f;
+            for (size_t lane = 0; lane < L::size; ++lane)
+                maximum = juce::jmax (maximum, L::get (maxima, lane));
 
-        return output * 4.0f; // Normalize
+            for (; i < numSamples; ++i)
+                maximum = juce::jmax (maximum, increments[i]);
+
+            return maximum;
+        }
+
+        /** The increments of Lanes::size consecutive samples from i. */
+        template <typename SampleType>
+        SampleType get (int i) const noexcept
+        {
+            using L = Lanes<SampleType>;
+            return L::clamp (L::loadUnaligned (increments + i), minimumIncrement, 0.5f);
+        }
+
+        /**
+            For each lane of the register from i, the sum of the increments before it:
+            the register of increments shifted up one lane at a time and added, with
+            each shift read from the buffer one sample earlier.
+        */
+        template <typename SampleType>
+        SampleType leadIn (int i) const noexcept
+        {
+            using L = Lanes<SampleType>;
+            SampleType sum (0.0f);
+
+            // The first register would read before the buffer, so it is summed lane by lane
+            if (i < static_cast<int> (L::size))
+            {
+                float total = 0.0f;
+
+                for (size_t lane = 0; lane < L::size; ++lane)
+                {
+                    L::set (sum, lane, total);
+                    total += (*this)[i + static_cast<int> (lane)];
+                }
+
+                return sum;
+            }
+
+            // Unrolled, so each shift's lane mask is a constant
+            [&]<size_t... shift> (std::index_sequence<shift...>)
+            {
+                ((sum += L::fromLane (get<SampleType> (i - static_cast<int> (shift + 1)), shift + 1)), ...);
+            } (std::make_index_sequence<L::size - 1>());
+
+            return sum;
+        }
+    };
+
+    /** The type switch for a block; each kernel reads its increment from pitch, which inlines to a constant when fixed. */
+    template <typename Pitch>
+    void renderBlock (float* output, int numSamples, Pitch pitch) noexcept
+    {
+        switch (oscType)
+        {
+            case PolyBLEP:  processPolyBLEPBlock (output, numSamples, pitch); break;
+            case Wavetable: processWavetableBlock (output, numSamples, pitch); break;
+            case Detuned:   processDetunedBlock (output, numSamples, pitch); break;
+            case DPW:
+            default:
+                if (dpwOrder == 3)
+                    processDPWBlock<3> (output, numSamples, pitch);
+                else
+                    processDPWBlock<2> (output, numSamples, pitch);
+                break;
+        }
     }
 
-    float processPolyBLEP() noexcept
+    //==============================================================================
+    /**
+        Runs a waveform over the block a register of consecutive samples at a time,
+        then the last few samples one by one; the waveform is called with the phases
+        and increments of those samples, as a VoiceLanes or as a float.
+
+        Each lane's phase is the carried phase plus its lead-in from the pitch, so
+        a modulated pitch runs on registers too, and the only step that waits on
+        the previous register is one scalar add.
+    */
+    template <typename Pitch, typename Waveform>
+    void renderPhases (float* output, int numSamples, Pitch pitch, Waveform&& waveform) noexcept
     {
-        // Simplified PolyBLEP (bandlimited step function)
-        float t = phase;
-        float saw = 2.0f * t - 1.0f;
+        using L = Lanes<VoiceLanes>;
+        constexpr int width = static_cast<int> (L::size);
+        const int registerEnd = numSamples - numSamples % width;
+        auto p = phase;
+
+        for (int i = 0; i < registerEnd; i += width)
+        {
+            const auto increments = pitch.template get<VoiceLanes> (i);
+            auto phases = pitch.template leadIn<VoiceLanes> (i) + p;
+            phases = phases - L::truncate (phases);
+            L::storeUnaligned (waveform (phases, increments), output + i);
 
-        // Naive BLEP correction at discontinuity
-        float blep = 0.0f;
-        if (phase < 0.1f)
+            // A register spans up to width / 2 cycles, so the wrap truncates; it is
+            // rarely taken, so it stays off the add chain
+            p += L::sum (increments);
+
+            if (p >= 1.0f)
+                p -= Lanes<float>::truncate (p);
+        }
+
+        for (int i = registerEnd; i < numSamples; ++i)
         {
-            float x = phase / 0.1f;
-            blep = x * x * (3.0f - 2.0f * x); // Smoothstep
+            const auto increment = pitch.template get<float> (i);
+            output[i] = waveform (p, increment);
+            p = Lanes<float>::wrapPhase (p + increment);
         }
 
-        // Update phase
-        phase += frequency / static_cast<float>(sampleRate);
-        if (phase >= 1.0f) phase -= 1.0f;
+        phase = p;
+    }
 
-        return saw + blep * 0.1f;
+    //==============================================================================
+    /** DPW gain: undoes the polynomial's scaling and the differentiators' 2 * increment per step. */
+    template <int Order, typename SampleType>
+    static SampleType dpwScaleFor (SampleType increment) noexcept
+    {
+        using L = Lanes<SampleType>;
+
+        if constexpr (Order == 2)
+            return L::divide (SampleType (0.25f), increment);
+        else
+            return L::divide (SampleType (1.0f / 24.0f), increment * increment);
     }
 
-    float processWavetable() noexcept
+    /**
+        Differentiated Polynomial Waveform sawtooth (Valimaki 2010): the naive saw x
+        is integrated in closed form by the polynomial x^2 or x^3 - x, then
+        differentiated Order - 1 times. The polynomial has no step, so far less of
+        the discontinuity aliases.
+
+        The earlier samples are this one's phase stepped back by its increment, so
+        every lane works alone and the oscillator keeps no differentiator memory.
+        Each difference of the polynomial is factored through the exact step in x
+        (2 * increment, less 2 across the reset), so the 1 / increment^2 gain
+        doesn't magnify rounding.
+    */
+    template <int Order, typename SampleType>
+    static SampleType dpwSamples (SampleType phases, SampleType increments, SampleType scale) noexcept
     {
-        // Simple wavetable with sine + harmonics
-        float t = phase * 2.0f * juce::MathConstants<float>::pi;
-        float output = std::sin(t);
-        output += 0.5f * std::sin(2.0f * t);
-        output += 0.25f * std::sin(3.0f * t);
-        output += 0.125f * std::sin(4.0f * t);
+        using L = Lanes<SampleType>;
 
-        // Normalize
-        output /= 1.875f;
+        const SampleType step = increments * 2.0f;
+        const auto stepBack = [&] (SampleType p, SampleType& wrapped)
+        {
+            wrapped = SampleType (1.0f) - L::truncate (p - increments + 1.0f);
+            return p - increments + wrapped;
+        };
 
-        // Update phase
-        phase += frequency / static_cast<float>(sampleRate);
-        if (phase >= 1.0f) phase -= 1.0f;
+        SampleType wrapped;
+        const SampleType previousPhase = stepBack (phases, wrapped);
+        const SampleType x = phases * 2.0f - 1.0f;
+        const SampleType dx = step - wrapped * 2.0f;
+        const SampleType previousX = x - dx;
 
-        return output;
+        if constexpr (Order == 2)
+        {
+            return dx * (x + previousX) * scale;
+        }
+        else
+        {
+            SampleType wrappedBefore;
+            stepBack (previousPhase, wrappedBefore);
+            const SampleType previousDx = step - wrappedBefore * 2.0f;
+            const SampleType earlierX = previousX - previousDx;
+
+            const SampleType delta = dx * (x * x + x * previousX + previousX * previousX - 1.0f);
+            const SampleType previousDelta = previousDx * (previousX * previousX + previousX * earlierX + earlierX * earlierX - 1.0f);
+            return (delta - previousDelta) * scale;
+        }
     }
 
-    float processDetuned() noexcept
+    template <int Order, typename Pitch>
+    void processDPWBlock (float* output, int numSamples, Pitch pitch) noexcept
     {
-        // Detuned sawtooth bank
-        float output = 0.0f;
+        const auto fixedScale = dpwScale;
 
-        for (int i = 0; i < numVoices; ++i)
+        renderPhases (output, numSamples, pitch, [fixedScale] (auto phases, auto increments)
         {
-            float detune = (static_cast<float>(i) - static_cast<float>(numVoices) * 0.5f) * detuneAmount;
-            float detuneFreq = frequency * std::pow(2.0f, detune / 1200.0f); // Cents
+            using SampleType = decltype (phases);
+
+            if constexpr (Pitch::isModulated)
+                return dpwSamples<Order> (phases, increments, dpwScaleFor<Order> (increments));
+            else
+                return dpwSamples<Order> (phases, increments, SampleType (fixedScale));
+        });
+    }
+
+    /**
+        Band-limited minus naive unit step at phase 0, two samples wide (Valimaki &
+        Huovilainen 2007). Each half is clamped to zero outside its own sample
+        instead of branching, so it runs on lanes.
+    */
+    template <typename SampleType>
+    static SampleType polyBLEP (SampleType t, SampleType inverseDt) noexcept
+    {
+        using L = Lanes<SampleType>;
 
-            float t = phase + static_cast<float>(i) * 0.01f; // Phase offset
-            float saw = 2.0f * t - 1.0f;
-            output += saw;
+        const SampleType after = L::min (t * inverseDt - 1.0f, SampleType (0.0f));
+        const SampleType before = L::max ((t - 1.0f) * inverseDt + 1.0f, SampleType (0.0f));
+        return (before * before - after * after) * 0.5f;
+    }
+
+    /** Integral of polyBLEP: the correction for a unit change of slope per sample at phase 0. */
+    template <typename SampleType>
+    static SampleType polyBLAMP (SampleType t, SampleType inverseDt) noexcept
+    {
+        using L = Lanes<SampleType>;
+
+        const SampleType after = L::max (SampleType (1.0f) - t * inverseDt, SampleType (0.0f));
+        const SampleType before = L::max ((t - 1.0f) * inverseDt + 1.0f, SampleType (0.0f));
+        return (after * after * after + before * before * before) * (1.0f / 6.0f);
+    }
+
+    template <PolyBLEPWaveform Waveform, typename SampleType>
+    static SampleType polyBLEPSamples (SampleType t, SampleType dt) noexcept
+    {
+        using L = Lanes<SampleType>;
+
+        const SampleType inverseDt = L::divide (SampleType (1.0f), dt);
+        const SampleType half = L::wrapPhase (t + 0.5f);
+
+        if constexpr (Waveform == PolyBLEPWaveform::Square)
+        {
+            // Steps of +2 at phase 0 and -2 at phase 0.5; half - t is +0.5 before the second, -0.5 after it
+            return (half - t) * 2.0f + (polyBLEP (t, inverseDt) - polyBLEP (half, inverseDt)) * 2.0f;
+        }
+        else if constexpr (Waveform == PolyBLEPWaveform::Triangle)
+        {
+            // Slope turns from +4 to -4 per cycle at phase 0 and back at phase 0.5
+            return L::max (t - 0.5f, SampleType (0.5f) - t) * 4.0f - 1.0f
+                 + (polyBLAMP (half, inverseDt) - polyBLAMP (t, inverseDt)) * (dt * 8.0f);
+        }
+        else
+        {
+            // Step of -2 at phase 0
+            return t * 2.0f - 1.0f - polyBLEP (t, inverseDt) * 2.0f;
+        }
+    }
+
+    template <typename Pitch>
+    void processPolyBLEPBlock (float* output, int numSamples, Pitch pitch) noexcept
+    {
+        switch (polyBLEPWaveform)
+        {
+            case PolyBLEPWaveform::Square:
+                renderPhases (output, numSamples, pitch, [] (auto t, auto dt) { return polyBLEPSamples<PolyBLEPWaveform::Square> (t, dt); });
+                break;
+
+            case PolyBLEPWaveform::Triangle:
+                renderPhases (output, numSamples, pitch, [] (auto t, auto dt) { return polyBLEPSamples<PolyBLEPWaveform::Triangle> (t, dt); });
+                break;
+
+            case PolyBLEPWaveform::Saw:
+            default:
+                renderPhases (output, numSamples, pitch, [] (auto t, auto dt) { return polyBLEPSamples<PolyBLEPWaveform::Saw> (t, dt); });
+                break;
+        }
+    }
+
+    template <typename Pitch>
+    void processWavetableBlock (float* output, int numSamples, Pitch pitch) noexcept
+    {
+        // A modulated block plays the level for its highest pitch, so no part of a sweep aliases
+        const float* level = Pitch::isModulated ? wavetables->getLevel (WavetableMipmaps::levelForIncrement (pitch.getMaximum (numSamples)))
+                                                : wavetableLevel;
+
+        // Phases first, then the lookups; those are per sample, but no longer wait on each other
+        renderPhases (output, numSamples, pitch, [] (auto phases, auto) { return phases; });
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            // Linear interpolation into the mip level picked for the current frequency
+            const float position = output[i] * static_cast<float>(WavetableMipmaps::tableSize);
+            const int index = static_cast<int>(position);
+            const float frac = position - static_cast<float>(index);
+            const float* table = level + index;
+            output[i] = table[0] + frac * (table[1] - table[0]);
         }
+    }
+
+    template <bool Modulated>
+    float detunedSample (float increment) noexcept
+    {
+        // Detuned sawtooth bank: every unison voice has its own phase, and a
+        // register of voices advances per instruction. Each saw is 2p - 1
+        // weighted by 1/numVoices, so the constant parts sum to -1.
+        VoiceLanes sum (0.0f);
+
+        for (int r = 0; r < numUnisonRegisters; ++r)
+        {
+            const auto index = static_cast<size_t> (r);
+            const VoiceLanes step = Modulated ? unisonRatios[index] * increment : unisonIncrements[index];
+            const auto p = UnisonLanes::wrapPhase (unisonPhases[index] + step);
+            unisonPhases[index] = p;
+            sum += p * unisonGains[index];
+        }
+
+        return UnisonLanes::sum (sum) - 1.0f;
+    }
 
-        output /= static_cast<float>(numVoices);
+    template <typename Pitch>
+    void processDetunedBlock (float* output, int numSamples, Pitch pitch) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = detunedSample<Pitch::isModulated> (pitch[i]);
+    }
+
+    /** Recomputes everything derived from the pitch; runs only when frequency, order or sample rate change. */
+    void updateIncrements() noexcept
+    {
+        phaseIncrement = frequency / static_cast<float>(sampleRate);
 
-        // Update phase
-        phase += frequency / static_cast<float>(sampleRate);
-        if (phase >= 1.0f) phase -= 1.0f;
+        dpwScale = dpwOrder == 3 ? dpwScaleFor<3> (phaseIncrement) : dpwScaleFor<2> (phaseIncrement);
 
-        return output;
+        // Richest mip level whose top harmonic stays below Nyquist
+        wavetableLevel = wavetables->getLevel (WavetableMipmaps::levelForIncrement (phaseIncrement));
+
+        updateUnison();
+    }
+
+    /** Works out per-voice ratios, increments and gains; runs only when a parameter changes. */
+    void updateUnison() noexcept
+    {
+        const float baseIncrement = phaseIncrement;
+        const float gain = 2.0f / static_cast<float>(numVoices);
+
+        for (int i = 0; i < maxUnisonVoices; ++i)
+        {
+            const bool active = i < numVoices;
+            const float spread = numVoices > 1 ? 2.0f * static_cast<float>(i) / static_cast<float>(numVoices - 1) - 1.0f : 0.0f;
+            const float ratio = FastMath::exp2 (spread * detuneAmount / 1200.0f);
+
+            auto& ratios = unisonRatios[static_cast<size_t> (i) / unisonLaneWidth];
+            auto& increments = unisonIncrements[static_cast<size_t> (i) / unisonLaneWidth];
+            auto& gains = unisonGains[static_cast<size_t> (i) / unisonLaneWidth];
+            UnisonLanes::set (ratios, static_cast<size_t> (i) % unisonLaneWidth, active ? ratio : 0.0f);
+            UnisonLanes::set (increments, static_cast<size_t> (i) % unisonLaneWidth, active ? baseIncrement * ratio : 0.0f);
+            UnisonLanes::set (gains, static_cast<size_t> (i) % unisonLaneWidth, active ? gain : 0.0f);
+        }
+
+        numUnisonRegisters = (numVoices + static_cast<int> (unisonLaneWidth) - 1) / static_cast<int> (unisonLaneWidth);
     }
 
     //==============================================================================
+    /**
+        Band-limited copies of the wavetable, one per octave. Level L keeps
+        harmonics up to tableSize / 2^(L + 1), so it is alias-free for phase
+        increments up to 2^L / tableSize. The tables depend only on the
+        increment, not the sample rate, so every oscillator shares one set.
+    */
+    struct WavetableMipmaps
+    {
+        static constexpr int tableSize = 2048;
+        static constexpr int numLevels = 11;   // down to a single harmonic at increment 0.5
+
+        /** Built when the first oscillator is constructed, so never on the audio thread. */
+        static const WavetableMipmaps& get()
+        {
+            static const WavetableMipmaps instance;
+            return instance;
+        }
+
+        static int levelForIncrement (float increment) noexcept
+        {
+            int level = 0;
+            while (level < numLevels - 1 && increment * static_cast<float>(tableSize) > static_cast<float>(1 << level))
+                ++level;
+
+            return level;
+        }
+
+        /** Returns tableSize + 1 samples; the last repeats the first for interpolation. */
+        const float* getLevel (int level) const noexcept
+        {
+            return tables[static_cast<size_t> (level)].data();
+        }
+
+    private:
+        WavetableMipmaps()
+        {
+            // Sine plus three harmonics at halving levels, normalised to +/-1 peak
+            static constexpr float harmonicGains[] = { 1.0f, 0.5f, 0.25f, 0.125f };
+            static constexpr float normalisation = 1.0f / 1.875f;
+            constexpr int numHarmonics = static_cast<int>(std::size (harmonicGains));
+
+            for (int level = 0; level < numLevels; ++level)
+            {
+                auto& table = tables[static_cast<size_t> (level)];
+                const int maxHarmonic = std::min (numHarmonics, tableSize >> (level + 1));
+
+                for (int i = 0; i <= tableSize; ++i)
+                {
+                    const double t = juce::MathConstants<double>::twoPi * static_cast<double>(i) / static_cast<double>(tableSize);
+                    double value = 0.0;
+
+                    for (int h = 1; h <= maxHarmonic; ++h)
+                        value += harmonicGains[h - 1] * std::sin (static_cast<double>(h) * t);
+
+                    table[static_cast<size_t> (i)] = static_cast<float>(value) * normalisation;
+                }
+            }
+        }
+
+        std::array<std::array<float, tableSize + 1>, numLevels> tables;
+    };
+
+    const WavetableMipmaps* wavetables = &WavetableMipmaps::get();
+    const float* wavetableLevel = nullptr;
+
+    using UnisonLanes = Lanes<VoiceLanes>;
+    static constexpr size_t unisonLaneWidth = UnisonLanes::size;
+    static constexpr size_t unisonRegisters = maxUnisonVoices / unisonLaneWidth;
+
+    std::array<VoiceLanes, unisonRegisters> unisonPhases {};
+    std::array<VoiceLanes, unisonRegisters> unisonRatios {};
+    std::array<VoiceLanes, unisonRegisters> unisonIncrements {};
+    std::array<VoiceLanes, unisonRegisters> unisonGains {};
+    int numUnisonRegisters = 1;
+    juce::Random random { 0x5eed };
+
     OscillatorType oscType;
     double sampleRate;
     float phase;
+    float phaseIncrement = 0.0f;
     float frequency;
     float detuneAmount;
     int numVoices;
 
+    float dpwScale = 1.0f;
+    int dpwOrder = 2;
+    PolyBLEPWaveform polyBLEPWaveform = PolyBLEPWaveform::Saw;
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (OscillatorBank)
 };
@@ -0,0 +1,501 @@
+/*
+  ==============================================================================
+
+    Oversampler.h
+    Created: 17 Oct 2026 3:00:00pm
+    Author:  White Room Audio
+
+    2x/4x/8x oversampling built from cascaded polyphase half-band filters.
+    Linear-phase mode uses symmetric FIR half-bands; minimum-phase mode uses
+    pairs of allpass chains, which have far less latency but bend the phase.
+
+    SampleType is either float or a SIMD register holding one voice per lane,
+    so a whole voice group is oversampled per instruction.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <cmath>
+#include <vector>
+#include "SIMDLanes.h"
+
+namespace Growl {
+namespace DSP {
+
+enum class OversamplingFilter
+{
+    LinearPhase = 0,
+    MinimumPhase = 1
+};
+
+//==============================================================================
+/**
+    Coefficient design for the half-band filters. Runs when oversampling is
+    configured, never on the audio thread.
+*/
+struct HalfbandDesign
+{
+    /**
+        Kaiser-windowed half-band FIR. Returns only the non-zero polyphase taps
+        (every other tap of a half-band is zero apart from the 0.5 centre tap).
+        transition is the half-width of the transition band around a quarter of
+        the sample rate, as a fraction of the sample rate.
+    */
+    static std::vector<float> firTaps (double transition, double attenuationDb)
+    {
+        const double deltaOmega = 2.0 * juce::MathConstants<double>::pi * 2.0 * transition;
+        const int estimate = static_cast<int> (std::ceil ((attenuationDb - 7.95) / (2.285 * deltaOmega))) + 1;
+        const int halfLength = juce::jmax (2, (estimate + 1 + 3) / 4);     // length is 4 * halfLength - 1
+        const int length = 4 * halfLength - 1;
+        const int centre = (length - 1) / 2;
+        const double beta = 0.1102 * (attenuationDb - 8.7);
+
+        std::vector<float> taps;
+
+        for (int n = 0; n < length; n += 2)
+        {
+            const double offset = n - centre;
+            const double ratio = 2.0 * n / (length - 1) - 1.0;
+            const double window = besselI0 (beta * std::sqrt (1.0 - ratio * ratio)) / besselI0 (beta);
+            const double sinc = std::sin (juce::MathConstants<double>::halfPi * offset) / (juce::MathConstants<double>::pi * offset);
+            taps.push_back (static_cast<float> (sinc * window));
+        }
+
+        return taps;
+    }
+
+    /**
+        Elliptic allpass half-band coefficients for the polyphase IIR structure,
+        after the classic design by Valenzuela and Constantinides.
+    */
+    static std::vector<float> allpassCoefficients (int numCoefficients, double transition)
+    {
+        const int order = numCoefficients * 2 + 1;
+        const double pi = juce::MathConstants<double>::pi;
+
+        double k = std::tan ((1.0 - transition * 2.0) * pi / 4.0);
+        k *= k;
+
+        const double kksqrt = std::pow (1.0 - k * k, 0.25);
+        const double e = 0.5 * (1.0 - kksqrt) / (1.0 + kksqrt);
+        const double e4 = e * e * e * e;
+        const double q = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+
+        std::vector<float> coefficients;
+
+        for (int index = 0; index < numCoefficients; ++index)
+        {
+            const int c = index + 1;
+
+            double num = 0.0, term = 0.0, sign = 1.0;
+            for (int i = 0; i == 0 || std::abs (term) > 1.0e-100; ++i, sign = -sign)
+            {
+                term = std::pow (q, i * (i + 1)) * std::sin ((i * 2 + 1) * c * pi / order) * sign;
+                num += term;
+            }
+
+            double den = 0.0;
+            sign = -1.0;
+            for (int i = 1; i == 1 || std::abs (term) > 1.0e-100; ++i, sign = -sign)
+            {
+                term = std::pow (q, i * i) * std::cos (i * 2 * c * pi / order) * sign;
+                den += term;
+            }
+
+            const double ww = num * std::pow (q, 0.25) / (den + 0.5);
+            const double wwsq = ww * ww;
+            const double x = std::sqrt ((1.0 - wwsq * k) * (1.0 - wwsq / k)) / (1.0 + wwsq);
+
+            coefficients.push_back (static_cast<float> ((1.0 - x) / (1.0 + x)));
+        }
+
+        return coefficients;
+    }
+
+private:
+    static double besselI0 (double x)
+    {
+        double sum = 1.0, term = 1.0;
+
+        for (int k = 1; k < 50 && term > 1.0e-12 * sum; ++k)
+        {
+            const double t = x / (2.0 * k);
+            term *= t * t;
+            sum += term;
+        }
+
+        return sum;
+    }
+};
+
+//==============================================================================
+/**
+    Linear-phase polyphase half-band: the zero taps are skipped and the centre
+    tap becomes a plain delay, so each output costs half the filter length.
+*/
+template <typename SampleType>
+class FirHalfband
+{
+public:
+    void setTaps (std::vector<float> newTaps)
+    {
+        taps = std::move (newTaps);
+        numTaps = static_cast<int> (taps.size());
+        centreDelay = numTaps / 2 - 1;
+        history.setSize (numTaps);
+        oddHistory.setSize (numTaps);
+    }
+
+    /** Latency in samples at the higher of the two rates, for one pass. */
+    int getLatency() const noexcept
+    {
+        return numTaps - 1;
+    }
+
+    /** Doubles the rate: numSamples in, 2 * numSamples out. */
+    void upsample (const SampleType* input, SampleType* output, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto* h = history.push (input[i]);
+            output[2 * i] = convolve (h) * 2.0f;
+            output[2 * i + 1] = h[centreDelay];
+        }
+    }
+
+    /** Halves the rate: 2 * numSamples in, numSamples out. */
+    void downsample (const SampleType* input, SampleType* output, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto* h = history.push (input[2 * i]);
+            const auto* odd = oddHistory.push (input[2 * i + 1]);
+            output[i] = convolve (h) + odd[centreDelay + 1] * 0.5f;
+        }
+    }
+
+    void reset() noexcept
+    {
+        history.reset();
+        oddHistory.reset();
+    }
+
+    void resetLane (size_t lane) noexcept
+    {
+        history.resetLane (lane);
+        oddHistory.resetLane (lane);
+    }
+
+private:
+    /** Ring buffer stored twice over, so the newest numTaps samples are always contiguous. */
+    struct History
+    {
+        void setSize (int newSize)
+        {
+            size = newSize;
+            data.assign (static_cast<size_t> (size * 2), SampleType (0.0f));
+            position = 0;
+        }
+
+        /** Returns a window holding the newest sample first. */
+        const SampleType* push (SampleType x) noexcept
+        {
+            position = (position == 0 ? size : position) - 1;
+            data[static_cast<size_t> (position)] = x;
+            data[static_cast<size_t> (position + size)] = x;
+            return data.data() + position;
+        }
+
+        void reset() noexcept
+        {
+            std::fill (data.begin(), data.end(), SampleType (0.0f));
+        }
+
+        void resetLane (size_t lane) noexcept
+        {
+            for (auto& s : data)
+                Lanes<SampleType>::set (s, lane, 0.0f);
+        }
+
+        std::vector<SampleType> data;
+        int size = 0, position = 0;
+    };
+
+    SampleType convolve (const SampleType* h) const noexcept
+    {
+        SampleType sum = 0.0f;
+
+        for (int k = 0; k < numTaps; ++k)
+            sum += h[k] * taps[static_cast<size_t> (k)];
+
+        return sum;
+    }
+
+    std::vector<float> taps;
+    History history, oddHistory;
+    int numTaps = 0, centreDelay = 0;
+};
+
+//==============================================================================
+/**
+    Minimum-phase polyphase half-band made of two chains of first-order
+    allpass sections running at the lower rate.
+*/
+template <typename SampleType>
+class IirHalfband
+{
+public:
+    static constexpr int maxCoefficients = 12;
+
+    void setCoefficients (const std::vector<float>& newCoefficients)
+    {
+        numCoefficients = juce::jmin (maxCoefficients, static_cast<int> (newCoefficients.size()));
+
+        for (int i = 0; i < numCoefficients; ++i)
+            coefficients[static_cast<size_t> (i)] = newCoefficients[static_cast<size_t> (i)];
+
+        reset();
+    }
+
+    /**
+        Group delay at DC in samples at the higher rate, for one pass averaged
+        over up- and downsampling (they differ by one sample either way).
+    */
+    double getLatency() const noexcept
+    {
+        double delay = 0.0;
+
+        for (int i = 0; i < numCoefficients; ++i)
+        {
+            const double a = coefficients[static_cast<size_t> (i)];
+            delay += (1.0 - a) / (1.0 + a);
+        }
+
+        return delay;
+    }
+
+    void upsample (const SampleType* input, SampleType* output, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            output[2 * i] = processPath (input[i], 0);
+            output[2 * i + 1] = processPath (input[i], 1);
+        }
+    }
+
+    void downsample (const SampleType* input, SampleType* output, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = (processPath (input[2 * i + 1], 0) + processPath (input[2 * i], 1)) * 0.5f;
+    }
+
+    void reset() noexcept
+    {
+        for (auto& s : x1)  s = 0.0f;
+        for (auto& s : y1)  s = 0.0f;
+    }
+
+    void resetLane (size_t lane) noexcept
+    {
+        for (auto& s : x1)  Lanes<SampleType>::set (s, lane, 0.0f);
+        for (auto& s : y1)  Lanes<SampleType>::set (s, lane, 0.0f);
+    }
+
+private:
+    /** Path 0 uses the even coefficients, path 1 the odd ones. */
+    SampleType processPath (SampleType x, int path) noexcept
+    {
+        for (int i = path; i < numCoefficients; i += 2)
+        {
+            const auto index = static_cast<size_t> (i);
+            const SampleType y = (x - y1[index]) * coefficients[index] + x1[index];
+            x1[index] = x;
+            y1[index] = y;
+            x = y;
+        }
+
+        return x;
+    }
+
+    std::array<float, maxCoefficients> coefficients {};
+    std::array<SampleType, maxCoefficients> x1 {}, y1 {};
+    int numCoefficients = 0;
+};
+
+//==============================================================================
+/**
+    Up to three cascaded 2x stages. The first stage, next to the base rate,
+    gets the steepest filter; later stages only have to reject images that
+    sit far above the signal and use much shorter filters.
+
+    Blocks are processed in chunks of chunkSize base-rate samples, so the
+    working buffers stay small and are allocated once in setOversampling().
+*/
+template <typename SampleType>
+class Oversampler
+{
+public:
+    static constexpr int maxStages = 3;     // 8x
+    static constexpr int chunkSize = 64;
+
+    Oversampler() = default;
+    ~Oversampler() = default;
+
+    /** Sets 1x, 2x, 4x or 8x (numStages 0..3) and designs the filters. Not real-time safe. */
+    void setOversampling (int newNumStages, OversamplingFilter newFilter)
+    {
+        numStages = juce::jlimit (0, maxStages, newNumStages);
+        filter = newFilter;
+
+        // Passband edge relative to each stage's output rate halves at every stage,
+        // so the transition band can widen
+        static constexpr double transitions[maxStages] = { 0.03, 0.14, 0.2 };
+        static constexpr int allpassCounts[maxStages] = { 10, 4, 3 };
+
+        for (int s = 0; s < numStages; ++s)
+        {
+            const auto index = static_cast<size_t> (s);
+
+            if (filter == OversamplingFilter::LinearPhase)
+            {
+                auto taps = HalfbandDesign::firTaps (transitions[s], 90.0);
+                firUp[index].setTaps (taps);
+                firDown[index].setTaps (taps);
+            }
+            else
+            {
+                const auto coefficients = HalfbandDesign::allpassCoefficients (allpassCounts[s], transitions[s]);
+                iirUp[index].setCoefficients (coefficients);
+                iirDown[index].setCoefficients (coefficients);
+            }
+
+            buffers[index].assign (static_cast<size_t> (chunkSize << (s + 1)), SampleType (0.0f));
+        }
+    }
+
+    int getFactor() const noexcept
+    {
+        return 1 << numStages;
+    }
+
+    /** Total up and down latency in base-rate samples. */
+    double getLatencyInSamples() const noexcept
+    {
+        double latency = 0.0;
+
+        for (int s = 0; s < numStages; ++s)
+        {
+            const auto index = static_cast<size_t> (s);
+            const double stageLatency = filter == OversamplingFilter::LinearPhase
+                                          ? firUp[index].getLatency() + firDown[index].getLatency()
+                                          : iirUp[index].getLatency() + iirDown[index].getLatency();
+
+            latency += stageLatency / static_cast<double> (2 << s);
+        }
+
+        return latency;
+    }
+
+    /**
+        Runs process on the oversampled signal: upsamples input, calls
+        process (buffer, numOversampledSamples) on each chunk, and downsamples
+        the result into output. output may alias input.
+    */
+    template <typename Processor>
+    void process (SampleType* output, const SampleType* input, int numSamples, Processor&& processChunk) noexcept
+    {
+        jassert (numStages > 0);
+
+        for (int start = 0; start < numSamples; start += chunkSize)
+        {
+            const int n = juce::jmin (chunkSize, numSamples - start);
+            const SampleType* source = input + start;
+
+            for (int s = 0; s < numStages; ++s)
+            {
+                upsampleStage (s, source, buffers[static_cast<size_t> (s)].data(), n << s);
+                source = buffers[static_cast<size_t> (s)].data();
+            }
+
+            auto* oversampled = buffers[static_cast<size_t> (numStages - 1)].data();
+            processChunk (oversampled, n << numStages);
+
+            for (int s = numStages - 1; s >= 0; --s)
+            {
+                auto* destination = s > 0 ? buffers[static_cast<size_t> (s - 1)].data() : output + start;
+                downsampleStage (s, buffers[static_cast<size_t> (s)].data(), destination, n << s);
+            }
+        }
+    }
+
+    void reset() noexcept
+    {
+        for (int s = 0; s < maxStages; ++s)
+        {
+            const auto index = static_cast<size_t> (s);
+            firUp[index].reset();
+            firDown[index].reset();
+            iirUp[index].reset();
+            iirDown[index].reset();
+        }
+    }
+
+    /** Clears the filter history of a single voice lane. */
+    void resetLane (size_t lane) noexcept
+    {
+        for (int s = 0; s < numStages; ++s)
+        {
+            const auto index = static_cast<size_t> (s);
+
+            if (filter == OversamplingFilter::LinearPhase)
+            {
+                firUp[index].resetLane (lane);
+                firDown[index].resetLane (lane);
+            }
+            else
+            {
+                iirUp[index].resetLane (lane);
+                iirDown[index].resetLane (lane);
+            }
+        }
+    }
+
+private:
+    void upsampleStage (int stage, const SampleType* input, SampleType* output, int numSamples) noexcept
+    {
+        const auto index = static_cast<size_t> (stage);
+
+        if (filter == OversamplingFilter::LinearPhase)
+            firUp[index].upsample (input, output, numSamples);
+        else
+            iirUp[index].upsample (input, output, numSamples);
+    }
+
+    void downsampleStage (int stage, const SampleType* input, SampleType* output, int numSamples) noexcept
+    {
+        const auto index = static_cast<size_t> (stage);
+
+        if (filter == OversamplingFilter::LinearPhase)
+            firDown[index].downsample (input, output, numSamples);
+        else
+            iirDown[index].downsample (input, output, numSamples);
+    }
+
+    //==============================================================================
+    int numStages = 0;
+    OversamplingFilter filter = OversamplingFilter::MinimumPhase;
+
+    std::array<FirHalfband<SampleType>, maxStages> firUp, firDown;
+    std::array<IirHalfband<SampleType>, maxStages> iirUp, iirDown;
+    std::array<std::vector<SampleType>, maxStages> buffers;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Oversampler)
+};
+
+} // namespace DSP
+} // namespace Growl
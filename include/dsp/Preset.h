@@ -78,8 +78,10 @@ struct PresetParameters
     float oscillatorMix;                 // 0.0 to 1.0
 
     // Formant frequencies (vocal tract resonances)
-    float formantFreqs[5];               // 5 formant frequencies in Hz
-    float formantQs[5];                  // 5 formant Q values (bandwidth)
+    static constexpr int maxFormants = 8;
+    int numFormants;                     // 1 to maxFormants; picks the filter bank size
+    float formantFreqs[maxFormants];     // Formant frequencies in Hz, the first numFormants used
+    float formantQs[maxFormants];        // Formant Q values (bandwidth)
 
     // Distortion stage
     DistortionType distortionType;
@@ -104,6 +106,7 @@ struct PresetParameters
           oscillatorType (OscillatorType::Detuned),
           oscillatorDetune (0.0f),
           oscillatorMix (0.5f),
+          numFormants (5),
           distortionType (DistortionType::SoftClip),
           drive (1.5f),
           tone (0.5f),
@@ -118,6 +121,9 @@ struct PresetParameters
         formantFreqs[2] = 2900.0f;
         formantFreqs[3] = 3900.0f;
         formantFreqs[4] = 4950.0f;
+        formantFreqs[5] = 5950.0f;
+        formantFreqs[6] = 6950.0f;
+        formantFreqs[7] = 7950.0f;
 
         // Default formant Q values
         formantQs[0] = 10.0f;
@@ -125,6 +131,9 @@ struct PresetParameters
         formantQs[2] = 15.0f;
         formantQs[3] = 15.0f;
         formantQs[4] = 20.0f;
+        formantQs[5] = 20.0f;
+        formantQs[6] = 20.0f;
+        formantQs[7] = 20.0f;
     }
 
     //==============================================================================
@@ -248,7 +257,7 @@ struct PresetParameters
 
         // Formant frequencies
         juce::ValueTree formants ("formants");
-        for (int i = 0; i < 5; ++i)
+        for (int i = 0; i < numFormants; ++i)
         {
             juce::ValueTree formant ("formant");
             formant.setProperty ("index", i, nullptr);
@@ -289,7 +298,10 @@ struct PresetParameters
         juce::ValueTree formants = preset.getChildWithName ("formants");
         if (formants.isValid())
         {
-            for (int i = 0; i < 5 && i < formants.getNumChildren(); ++i)
+            // As many formants as were saved; presets from before variable counts have five
+            params.numFormants = juce::jlimit (1, maxFormants, formants.getNumChildren());
+
+            for (int i = 0; i < params.numFormants; ++i)
             {
                 juce::ValueTree formant = formants.getChild (i);
                 params.formantFreqs[i] = formant.getProperty ("freq", 800.0f);
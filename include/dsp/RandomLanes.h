@@ -0,0 +1,136 @@
+/*
+  ==============================================================================
+
+    RandomLanes.h
+    Created: 17 Oct 2026 4:20:00pm
+    Author:  White Room Audio
+
+    Lock-free, per-instance uniform noise source: xoshiro128+ running several
+    independent streams side by side so a block fills several lanes at a time.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <cstdint>
+#include "SIMDLanes.h"
+
+namespace Growl {
+namespace DSP {
+
+//==============================================================================
+/**
+    xoshiro128+ (Blackman & Vigna) with numLanes streams in struct-of-arrays form.
+
+    Each step advances every stream once in a plain loop over the lanes, which
+    the compiler turns into vector shifts and xors. There is no global state or
+    lock, so any number of instances can run on any threads, and a given seed
+    always reproduces the same sequence. next() and fill() draw from the same
+    sequence, so per-sample and block rendering agree.
+*/
+class RandomLanes
+{
+public:
+    static constexpr int numLanes = 8;
+
+    RandomLanes()
+    {
+        setSeed (123456789u);
+    }
+
+    /** Restarts the sequence; every lane gets its own state, expanded from seed by splitmix64. */
+    void setSeed (uint32_t newSeed) noexcept
+    {
+        seed = newSeed;
+        uint64_t x = newSeed;
+
+        const auto splitmix = [&x]
+        {
+            uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            return z ^ (z >> 31);
+        };
+
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            const auto a = splitmix();
+            const auto b = splitmix();
+            s0[lane] = static_cast<uint32_t> (a);
+            s1[lane] = static_cast<uint32_t> (a >> 32);
+            s2[lane] = static_cast<uint32_t> (b);
+            s3[lane] = static_cast<uint32_t> (b >> 32) | 1u;   // never all zero
+        }
+
+        bufferedIndex = numLanes;
+    }
+
+    /** Replays the sequence from the last seed. */
+    void reset() noexcept
+    {
+        setSeed (seed);
+    }
+
+    /** One uniform sample in [-1, 1). */
+    float next() noexcept
+    {
+        if (bufferedIndex == numLanes)
+        {
+            step (buffered);
+            bufferedIndex = 0;
+        }
+
+        return buffered[bufferedIndex++];
+    }
+
+    /** numSamples uniform samples in [-1, 1); the same values next() would return. */
+    void fill (float* output, int numSamples) noexcept
+    {
+        int i = 0;
+
+        while (i < numSamples && bufferedIndex < numLanes)
+            output[i++] = buffered[bufferedIndex++];
+
+        for (; i + numLanes <= numSamples; i += numLanes)
+            step (output + i);
+
+        while (i < numSamples)
+            output[i++] = next();
+    }
+
+private:
+    //==============================================================================
+    /** Advances every lane once and writes one sample per lane; one loop per operation keeps each a single vector instruction. */
+    void step (float* output) noexcept
+    {
+        alignas (cacheLineSize) uint32_t result[numLanes];
+        alignas (cacheLineSize) uint32_t t[numLanes];
+
+        for (int lane = 0; lane < numLanes; ++lane)  result[lane] = s0[lane] + s3[lane];
+        for (int lane = 0; lane < numLanes; ++lane)  t[lane] = s1[lane] << 9;
+        for (int lane = 0; lane < numLanes; ++lane)  s2[lane] ^= s0[lane];
+        for (int lane = 0; lane < numLanes; ++lane)  s3[lane] ^= s1[lane];
+        for (int lane = 0; lane < numLanes; ++lane)  s1[lane] ^= s2[lane];
+        for (int lane = 0; lane < numLanes; ++lane)  s0[lane] ^= s3[lane];
+        for (int lane = 0; lane < numLanes; ++lane)  s2[lane] ^= t[lane];
+        for (int lane = 0; lane < numLanes; ++lane)  s3[lane] = (s3[lane] << 11) | (s3[lane] >> 21);
+
+        // The top 24 bits are the strong ones and fill a float mantissa exactly
+        for (int lane = 0; lane < numLanes; ++lane)
+            output[lane] = static_cast<float> (static_cast<int32_t> (result[lane] >> 8)) * (2.0f / 16777216.0f) - 1.0f;
+    }
+
+    //==============================================================================
+    alignas (cacheLineSize) uint32_t s0[numLanes];
+    uint32_t s1[numLanes];
+    uint32_t s2[numLanes];
+    uint32_t s3[numLanes];
+    alignas (cacheLineSize) float buffered[numLanes];
+    int bufferedIndex = numLanes;
+    uint32_t seed = 123456789u;
+};
+
+} // namespace DSP
+} // namespace Growl
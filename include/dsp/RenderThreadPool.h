@@ -0,0 +1,253 @@
+/*
+  ==============================================================================
+
+    RenderThreadPool.h
+    Created: 17 Oct 2026 2:00:00pm
+    Author:  White Room Audio
+
+    Persistent worker threads for spreading voice rendering across cores.
+    Tasks are split into per-thread ranges that idle threads steal from with
+    lock-free compare-and-swap; the calling audio thread takes part in the
+    work and then spins until the last task has finished.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "SIMDLanes.h"
+
+#if JUCE_LINUX || JUCE_BSD
+ #include <pthread.h>
+ #include <sched.h>
+#endif
+
+#if defined (__x86_64__) || defined (_M_X64) || defined (__i386__) || defined (_M_IX86)
+ #include <immintrin.h>
+#endif
+
+namespace Growl {
+namespace DSP {
+
+class RenderThreadPool
+{
+public:
+    /** Renders task taskIndex; threadIndex is 0 for the caller of run() and 1..n for workers. */
+    using Task = void (*) (void* context, int taskIndex, int threadIndex);
+
+    static constexpr int maxThreads = 16;
+
+    RenderThreadPool() = default;
+
+    ~RenderThreadPool()
+    {
+        stop();
+    }
+
+    /** Starts numWorkers threads in addition to the caller. Not real-time safe. */
+    void start (int numWorkers)
+    {
+        stop();
+
+        numWorkerThreads = juce::jlimit (0, maxThreads - 1, numWorkers);
+        running.store (true, std::memory_order_release);
+
+        for (int i = 0; i < numWorkerThreads; ++i)
+        {
+            workers.emplace_back ([this, i] { workerLoop (i + 1); });
+            setRealtimePriority (workers.back());
+        }
+    }
+
+    /** Stops and joins all workers. Not real-time safe. */
+    void stop()
+    {
+        running.store (false, std::memory_order_release);
+        generation.fetch_add (1, std::memory_order_acq_rel);
+        generation.notify_all();
+
+        for (auto& worker : workers)
+            worker.join();
+
+        workers.clear();
+        numWorkerThreads = 0;
+    }
+
+    int getNumThreads() const noexcept
+    {
+        return numWorkerThreads + 1;
+    }
+
+    /**
+        Runs tasks [0, numTasks) on the caller and the workers and returns once
+        all of them have finished. Never locks or allocates.
+    */
+    void run (int numTasks, Task task, void* context) noexcept
+    {
+        if (numTasks <= 0)
+            return;
+
+        // Published to workers by the release stores of the task ranges below
+        currentTask = task;
+        currentContext = context;
+        completed.store (0, std::memory_order_relaxed);
+
+        const int numParticipants = getNumThreads();
+
+        for (int t = 0; t < maxThreads; ++t)
+        {
+            const auto begin = t < numParticipants ? static_cast<uint32_t> (numTasks * t / numParticipants) : 0u;
+            const auto end = t < numParticipants ? static_cast<uint32_t> (numTasks * (t + 1) / numParticipants) : 0u;
+            ranges[static_cast<size_t> (t)].bounds.store (pack (begin, end), std::memory_order_release);
+        }
+
+        generation.fetch_add (1, std::memory_order_acq_rel);
+        generation.notify_all();
+
+        runTasks (0);
+
+        // Join: everything left is already executing on a worker
+        while (completed.load (std::memory_order_acquire) < numTasks)
+            cpuRelax();
+    }
+
+private:
+    //==============================================================================
+    struct alignas (cacheLineSize) TaskRange
+    {
+        std::atomic<uint64_t> bounds { 0 };  // begin in the low word, end in the high word
+    };
+
+    static constexpr uint64_t pack (uint32_t begin, uint32_t end) noexcept
+    {
+        return static_cast<uint64_t> (begin) | (static_cast<uint64_t> (end) << 32);
+    }
+
+    static constexpr uint32_t beginOf (uint64_t bounds) noexcept   { return static_cast<uint32_t> (bounds); }
+    static constexpr uint32_t endOf (uint64_t bounds) noexcept     { return static_cast<uint32_t> (bounds >> 32); }
+
+    static void cpuRelax() noexcept
+    {
+       #if defined (__x86_64__) || defined (_M_X64) || defined (__i386__) || defined (_M_IX86)
+        _mm_pause();
+       #elif defined (__aarch64__) || defined (__arm__)
+        __asm__ __volatile__ ("yield");
+       #endif
+    }
+
+    /** Takes the next task from the front of a thread's own range. */
+    int popFront (int threadIndex) noexcept
+    {
+        auto& range = ranges[static_cast<size_t> (threadIndex)].bounds;
+        auto bounds = range.load (std::memory_order_acquire);
+
+        while (beginOf (bounds) < endOf (bounds))
+        {
+            if (range.compare_exchange_weak (bounds, pack (beginOf (bounds) + 1, endOf (bounds)),
+                                             std::memory_order_acq_rel, std::memory_order_acquire))
+                return static_cast<int> (beginOf (bounds));
+        }
+
+        return -1;
+    }
+
+    /** Takes a task from the back of another thread's range. */
+    int steal (int thiefIndex) noexcept
+    {
+        const int numParticipants = getNumThreads();
+
+        for (int offset = 1; offset < numParticipants; ++offset)
+        {
+            auto& range = ranges[static_cast<size_t> ((thiefIndex + offset) % numParticipants)].bounds;
+            auto bounds = range.load (std::memory_order_acquire);
+
+            while (beginOf (bounds) < endOf (bounds))
+            {
+                if (range.compare_exchange_weak (bounds, pack (beginOf (bounds), endOf (bounds) - 1),
+                                                 std::memory_order_acq_rel, std::memory_order_acquire))
+                    return static_cast<int> (endOf (bounds) - 1);
+            }
+        }
+
+        return -1;
+    }
+
+    void runTasks (int threadIndex) noexcept
+    {
+        for (;;)
+        {
+            auto taskIndex = popFront (threadIndex);
+
+            if (taskIndex < 0)
+                taskIndex = steal (threadIndex);
+
+            if (taskIndex < 0)
+                return;
+
+            currentTask (currentContext, taskIndex, threadIndex);
+            completed.fetch_add (1, std::memory_order_acq_rel);
+        }
+    }
+
+    void workerLoop (int threadIndex)
+    {
+        auto seen = generation.load (std::memory_order_acquire);
+
+        for (;;)
+        {
+            // Spin briefly so back-to-back blocks don't pay for a wake-up, then sleep
+            for (int spin = 0; spin < spinIterations && generation.load (std::memory_order_acquire) == seen; ++spin)
+                cpuRelax();
+
+            generation.wait (seen, std::memory_order_acquire);
+            seen = generation.load (std::memory_order_acquire);
+
+            if (! running.load (std::memory_order_acquire))
+                return;
+
+            runTasks (threadIndex);
+        }
+    }
+
+    static void setRealtimePriority (std::thread& thread)
+    {
+       #if JUCE_LINUX || JUCE_BSD
+        // Needs RLIMIT_RTPRIO or CAP_SYS_NICE; without them the worker quietly
+        // stays on the normal scheduler
+        sched_param param {};
+        param.sched_priority = juce::jlimit (sched_get_priority_min (SCHED_FIFO),
+                                             sched_get_priority_max (SCHED_FIFO),
+                                             workerPriority);
+        pthread_setschedparam (thread.native_handle(), SCHED_FIFO, &param);
+       #else
+        juce::ignoreUnused (thread);
+       #endif
+    }
+
+    //==============================================================================
+    static constexpr int spinIterations = 2000;
+    static constexpr int workerPriority = 70;
+
+    std::array<TaskRange, maxThreads> ranges;
+    alignas (cacheLineSize) std::atomic<int> completed { 0 };
+    alignas (cacheLineSize) std::atomic<uint32_t> generation { 0 };
+    std::atomic<bool> running { false };
+
+    Task currentTask = nullptr;
+    void* currentContext = nullptr;
+
+    std::vector<std::thread> workers;
+    int numWorkerThreads = 0;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RenderThreadPool)
+};
+
+} // namespace DSP
+} // namespace Growl
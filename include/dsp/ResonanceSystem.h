@@ -6,7 +6,27 @@
     Author:  White Room Audio
 
     Formant-based resonance system for animal vocal synthesis.
-    Implements 5 parallel formant filters with size scaling.
+    Implements 1 to 8 parallel formant filters with size scaling.
+
+    SampleType is either float or a SIMD register; with a register, each lane
+    is an independent voice sharing the same formant settings. NumFormants is
+    fixed at compile time, so every loop over the formants unrolls;
+    ResonanceSystemVariant picks the specialisation at run time.
+
+    The formant bank is stored as struct-of-arrays. For a float voice, the
+    formants themselves fill the lanes of a register (padded with silent
+    formants), so the whole bank is one SIMD biquad per sample. For a
+    register of voices, the formants are a loop over registers. In both
+    cases the output gains are folded into the numerators.
+
+    Two engines run the bank: direct-form band-pass biquads (the default), and
+    topology-preserving-transform state-variable filters. The SVFs stay stable
+    while their cutoff moves every sample, so they can follow audio-rate
+    formant modulation.
+
+    With a FormantSizeTable set, the formants follow a creature size per
+    voice lane instead of the Hz settings, and the coefficients are
+    interpolated from the table rather than computed.
 
   ==============================================================================
 */
@@ -15,147 +35,827 @@
 
 #include <juce_dsp/juce_dsp.h>
 #include <juce_audio_basics/juce_audio_basics.h>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include "SIMDLanes.h"
+#include "FastMath.h"
+#include "FormantSizeTable.h"
 
 namespace Growl {
 namespace DSP {
 
+enum class FormantEngine
+{
+    Biquad = 0,
+    StateVariable = 1
+};
+
+//==============================================================================
+template <typename SampleType, int NumFormants = 5>
 class ResonanceSystem
 {
 public:
+    static constexpr int numFormants = NumFormants;
+
+    static_assert (numFormants >= 1 && numFormants <= maxFormants, "Unsupported formant count");
+
     ResonanceSystem()
         : sampleRate(48000.0),
           chestResonance(0.6f),
           throatConstriction(0.4f)
     {
-        // Default formant frequencies (Hz) - typical lion growl
-        float defaultFreqs[5] = {200.0f, 440.0f, 800.0f, 1500.0f, 2500.0f};
-        float defaultQs[5] = {8.0f, 8.0f, 6.0f, 5.0f, 4.0f};
-
         for (int i = 0; i < numFormants; ++i)
         {
-            formantFreqs[i] = defaultFreqs[i];
-            formantQs[i] = defaultQs[i];
-            formantStates[i] = {0.0f, 0.0f, 0.0f, 0.0f};
+            formantFreqs[i] = defaultFormantFreqs[i];
+            formantQs[i] = defaultFormantQs[i];
+            formantGains[i] = 1.0f;
         }
+
+        // SizeScaler's reference size, at which the formants are unscaled
+        for (auto& target : laneTargets)
+            target = FormantSizeTable::positionOf (10.0f);
+
+        prepare (sampleRate);
     }
 
     ~ResonanceSystem() = default;
 
+    /** Sets the sample rate, jumps straight to the current formant settings and clears the filters. */
+    void prepare (double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+
+        // One-pole approach towards the targets, stepped once per control interval
+        const double intervalsPerTimeConstant = smoothingTimeSeconds * sampleRate / static_cast<double> (controlInterval);
+        smoothingCoefficient = static_cast<float> (1.0 - std::exp (-1.0 / intervalsPerTimeConstant));
+
+        for (int i = 0; i < numFormants; ++i)
+        {
+            smoothedFreqs[i] = formantFreqs[i];
+            smoothedQs[i] = formantQs[i];
+        }
+
+        for (int lane = 0; lane < numVoiceLanes; ++lane)
+            lanePositions[lane] = laneTargets[lane];
+
+        isSmoothing = false;
+        samplesUntilUpdate = controlInterval;
+        calculateCoefficients();
+        reset();
+    }
+
     void setChestResonance (float mix)
     {
         chestResonance = juce::jlimit (0.0f, 1.0f, mix);
+        isSmoothing = true;   // the gains live in the coefficients
     }
 
     void setThroatConstriction (float constriction)
     {
         throatConstriction = juce::jlimit (0.0f, 1.0f, constriction);
+        isSmoothing = true;
+    }
+
+    /** Balance between the dry excitation (0) and the formant-filtered signal (1). */
+    void setMix (float newMix)
+    {
+        mix = juce::jlimit (0.0f, 1.0f, newMix);
+        isSmoothing = true;
+    }
+
+    /**
+        Switches between the biquad and the state-variable formant filters.
+        Both have the same response; only the SVFs can follow
+        processBlock()'s per-sample frequency modulation. Clears the filters.
+    */
+    void setEngine (FormantEngine newEngine)
+    {
+        engine = newEngine;
+        calculateCoefficients();
+        reset();
+    }
+
+    FormantEngine getEngine() const noexcept    { return engine; }
+
+    /**
+        Drives the formants from a size table instead of the Hz settings, with
+        a creature size per voice lane (setLaneSize). Pass nullptr to go back
+        to the Hz settings. The table must outlive its use here and be built
+        at this system's sample rate.
+    */
+    void setSizeTable (const FormantSizeTable* newTable) noexcept
+    {
+        jassert (newTable == nullptr || newTable->getSampleRate() == sampleRate);
+        sizeTable = newTable;
+        calculateCoefficients();
+    }
+
+    /** Glides one voice lane to a creature size over about smoothingTimeSeconds; only heard with a size table. */
+    void setLaneSize (size_t lane, float sizeFeet) noexcept
+    {
+        jassert (lane < static_cast<size_t> (numVoiceLanes));
+        laneTargets[lane] = FormantSizeTable::positionOf (sizeFeet);
+        isSmoothing = true;
     }
 
+    /** Glides to the new frequency over about smoothingTimeSeconds. */
     void setFormantFrequency (int index, float freq)
     {
         if (index >= 0 && index < numFormants)
+        {
             formantFreqs[index] = juce::jlimit (50.0f, 10000.0f, freq);
+            isSmoothing = true;
+        }
     }
 
+    /** Glides to the new Q over about smoothingTimeSeconds. */
     void setFormantQ (int index, float q)
     {
         if (index >= 0 && index < numFormants)
+        {
             formantQs[index] = juce::jlimit (1.0f, 20.0f, q);
+            isSmoothing = true;
+        }
     }
 
-    float process (float input) noexcept
+    SampleType process (SampleType input) noexcept
     {
-        float output = 0.0f;
+        if (isSmoothing && --samplesUntilUpdate <= 0)
+            updateSmoothing();
 
-        // Process through all 5 formant filters
-        for (int i = 0; i < numFormants; ++i)
+        if (engine == FormantEngine::StateVariable)
+            return processSvf (input, svfCoeffs, state);
+
+        return processSample (input, coeffs, state);
+    }
+
+    /**
+        Processes a whole buffer (output may alias input). The coefficients are
+        cached; while a formant glides they are recomputed once per control
+        interval, at the same samples as process() would.
+    */
+    void processBlock (SampleType* output, const SampleType* input, int numSamples) noexcept
+    {
+        if (engine == FormantEngine::StateVariable)
         {
-            float formantOutput = processFormant(input, i);
-            output += formantOutput * formantGains[i];
-        }
+            processSegments (numSamples, [this, output, input] (int begin, int end)
+            {
+                // Local copies, so that stores to output cannot force coefficients and state through memory
+                const SvfCoefficients segmentCoeffs = svfCoeffs;
+                BankState segmentState = state;
 
-        output /= static_cast<float>(numFormants);
+                for (int i = begin; i < end; ++i)
+                    output[i] = processSvf (input[i], segmentCoeffs, segmentState);
 
-        // Mix chest and throat resonance
-        float chest = output * chestResonance;
-        float throat = output * (1.0f - chestResonance);
+                state = segmentState;
+            });
+        }
+        else
+        {
+            processSegments (numSamples, [this, output, input] (int begin, int end)
+            {
+                const BankCoefficients segmentCoeffs = coeffs;
+                BankState segmentState = state;
 
-        // Apply throat constriction (boosts higher formants)
-        throat *= (1.0f + throatConstriction * 0.5f);
+                for (int i = begin; i < end; ++i)
+                    output[i] = processSample (input[i], segmentCoeffs, segmentState);
 
-        return chest + throat;
+                state = segmentState;
+            });
+        }
     }
 
-    void processBlock (float* output, const float* input, int numSamples) noexcept
+    /**
+        Processes a buffer while scaling every formant frequency by
+        frequencyMultipliers[i] at sample i (one multiplier per voice lane), for
+        jaw motion, wah sweeps and size glides at audio rate. The scaled cutoffs
+        are limited to just below Nyquist.
+
+        Needs the state-variable engine: its coefficients are recomputed every
+        sample, with the tan() prewarp taken from FastMath::sinCosQuarterTurn.
+        The biquad engine ignores the multipliers.
+    */
+    void processBlock (SampleType* output, const SampleType* input, const SampleType* frequencyMultipliers, int numSamples) noexcept
     {
-        for (int i = 0; i < numSamples; ++i)
-            output[i] = process(input[i]);
+        jassert (engine == FormantEngine::StateVariable);
+
+        if (engine != FormantEngine::StateVariable)
+        {
+            processBlock (output, input, numSamples);
+            return;
+        }
+
+        processSegments (numSamples, [this, output, input, frequencyMultipliers] (int begin, int end)
+        {
+            const SvfCoefficients segmentCoeffs = svfCoeffs;
+            BankState segmentState = state;
+
+            for (int i = begin; i < end; ++i)
+                output[i] = processSvfModulated (input[i], frequencyMultipliers[i], segmentCoeffs, segmentState);
+
+            state = segmentState;
+        });
     }
 
     void reset() noexcept
     {
-        for (auto& state : formantStates)
+        state.x1 = state.x2 = SampleType (0.0f);
+
+        for (int r = 0; r < numRegisters; ++r)
+            state.s1[r] = state.s2[r] = Bank (0.0f);
+    }
+
+    /**
+        Clears the filter state of a single voice lane, leaving the other lanes
+        ringing. With a size table, the lane also jumps straight to its target
+        size, so that a new note does not glide in.
+    */
+    void resetLane (size_t lane) noexcept
+    {
+        if (sizeTable != nullptr && lanePositions[lane] != laneTargets[lane])
+        {
+            lanePositions[lane] = laneTargets[lane];
+            calculateCoefficients();
+        }
+
+        if constexpr (formantsInLanes)
+        {
+            reset();   // a float voice has only the one lane
+        }
+        else
         {
-            state.x1 = state.x2 = state.y1 = state.y2 = 0.0f;
+            Lanes<SampleType>::set (state.x1, lane, 0.0f);
+            Lanes<SampleType>::set (state.x2, lane, 0.0f);
+
+            for (int r = 0; r < numRegisters; ++r)
+            {
+                Lanes<Bank>::set (state.s1[r], lane, 0.0f);
+                Lanes<Bank>::set (state.s2[r], lane, 0.0f);
+            }
         }
     }
 
 private:
     //==============================================================================
-    float processFormant (float input, int index) noexcept
+    // A float voice puts its formants in the lanes of a register; a register of voices loops over formants
+    static constexpr bool formantsInLanes = std::is_same_v<SampleType, float>;
+    using Bank = std::conditional_t<formantsInLanes, VoiceLanes, SampleType>;
+    static constexpr int bankWidth = formantsInLanes ? static_cast<int> (Lanes<Bank>::size) : 1;
+    static constexpr int numRegisters = (numFormants + bankWidth - 1) / bankWidth;
+    static constexpr int numVoiceLanes = formantsInLanes ? 1 : static_cast<int> (Lanes<SampleType>::size);
+
+    /** Samples between coefficient updates while a formant glides, and the glide time constant. */
+    static constexpr int controlInterval = 32;
+    static constexpr double smoothingTimeSeconds = 0.02;
+
+    /** Largest prewarp angle pi * f / sampleRate a modulated SVF may reach (about 0.48 x the sample rate). */
+    static constexpr float maxWarp = 1.5f;
+
+    /**
+        Band-pass biquads have b1 = 0 and b2 = -b0, so three numbers per
+        formant describe them. Padding formants have all three at zero.
+    */
+    struct BankCoefficients
+    {
+        Bank b0[numRegisters];
+        Bank a1[numRegisters];
+        Bank a2[numRegisters];
+        float dry;
+    };
+
+    /**
+        Simper's TPT state-variable band-pass, from g = tan (pi * f / sampleRate)
+        and k = 1 / Q. The band output has a peak gain of 1 / k, so gain
+        includes k; a padding formant has a zero gain and a zero prewarp angle.
+    */
+    struct SvfCoefficients
+    {
+        Bank warp[numRegisters];   // pi * f / sampleRate, scaled by the modulation
+        Bank k[numRegisters];
+        Bank a1[numRegisters];
+        Bank a2[numRegisters];
+        Bank a3[numRegisters];
+        Bank gain[numRegisters];
+        float dry;
+    };
+
+    /**
+        Two state values per formant: the last two outputs of a biquad, or the
+        two integrator states of an SVF. Every formant sees the same input, so
+        the biquads share one input history.
+    */
+    struct BankState
+    {
+        Bank s1[numRegisters];
+        Bank s2[numRegisters];
+        SampleType x1, x2;
+    };
+
+    /**
+        Runs processRange over [begin, end) stretches that fall between
+        coefficient updates, updating at the same samples as process() would.
+    */
+    template <typename Function>
+    void processSegments (int numSamples, Function&& processRange) noexcept
+    {
+        int i = 0;
+
+        while (i < numSamples)
+        {
+            // This sample is the one whose countdown triggers an update
+            if (isSmoothing && samplesUntilUpdate <= 1)
+            {
+                updateSmoothing();
+                processRange (i, i + 1);
+                ++i;
+                continue;
+            }
+
+            const int end = isSmoothing ? juce::jmin (numSamples, i + samplesUntilUpdate - 1) : numSamples;
+
+            if (isSmoothing)
+                samplesUntilUpdate -= end - i;
+
+            processRange (i, end);
+            i = end;
+        }
+    }
+
+    /** Steps every formant towards its target; once all have arrived, coefficients stop being recomputed. */
+    void updateSmoothing() noexcept
     {
-        auto& state = formantStates[index];
-        float freq = formantFreqs[index];
-        float Q = formantQs[index];
+        samplesUntilUpdate = controlInterval;
+        bool arrived = true;
 
-        // Calculate bandpass coefficients
-        float omega = 2.0f * juce::MathConstants<float>::pi * freq / static_cast<float>(sampleRate);
-        float alpha = std::sin(omega) / (2.0f * Q);
+        for (int i = 0; i < numFormants; ++i)
+        {
+            smoothedFreqs[i] += (formantFreqs[i] - smoothedFreqs[i]) * smoothingCoefficient;
+            smoothedQs[i] += (formantQs[i] - smoothedQs[i]) * smoothingCoefficient;
 
-        float b0 = alpha;
-        float b1 = 0.0f;
-        float b2 = -alpha;
-        float a0 = 1.0f + alpha;
-        float a1 = -2.0f * std::cos(omega);
-        float a2 = 1.0f - alpha;
+            // Within a hundredth of a percent: snap, since the rest is inaudible
+            if (std::abs (formantFreqs[i] - smoothedFreqs[i]) < formantFreqs[i] * 1.0e-4f)
+                smoothedFreqs[i] = formantFreqs[i];
+            if (std::abs (formantQs[i] - smoothedQs[i]) < formantQs[i] * 1.0e-4f)
+                smoothedQs[i] = formantQs[i];
 
-        // Normalize
-        b0 /= a0;
-        b1 /= a0;
-        b2 /= a0;
-        a1 /= a0;
-        a2 /= a0;
+            arrived = arrived && smoothedFreqs[i] == formantFreqs[i] && smoothedQs[i] == formantQs[i];
+        }
 
-        // Biquad difference equation
-        float output = b0 * input + b1 * state.x1 + b2 * state.x2 - a1 * state.y1 - a2 * state.y2;
+        for (int lane = 0; lane < numVoiceLanes; ++lane)
+        {
+            lanePositions[lane] += (laneTargets[lane] - lanePositions[lane]) * smoothingCoefficient;
 
-        state.x2 = state.x1;
-        state.x1 = input;
-        state.y2 = state.y1;
-        state.y1 = output;
+            // Within a thousandth of a table row: snap
+            if (std::abs (laneTargets[lane] - lanePositions[lane]) < 1.0e-3f)
+                lanePositions[lane] = laneTargets[lane];
 
-        return output;
+            arrived = arrived && lanePositions[lane] == laneTargets[lane];
+        }
+
+        isSmoothing = ! arrived;
+        calculateCoefficients();
     }
 
-    //==============================================================================
-    static constexpr int numFormants = 5;
+    static void setCoefficient (Bank* bank, int formant, float value) noexcept
+    {
+        if constexpr (formantsInLanes)
+            Lanes<Bank>::set (bank[formant / bankWidth], static_cast<size_t> (formant % bankWidth), value);
+        else
+            bank[formant] = Bank (value);
+    }
 
-    struct FormantState
+    /** Padding formants in both engines: zero output and, for the SVFs, a zero cutoff. */
+    void clearCoefficients() noexcept
     {
-        float x1, x2, y1, y2;
-    };
+        coeffs.dry = svfCoeffs.dry = 1.0f - mix;
+
+        for (int r = 0; r < numRegisters; ++r)
+        {
+            coeffs.b0[r] = coeffs.a1[r] = coeffs.a2[r] = Bank (0.0f);
+            svfCoeffs.warp[r] = svfCoeffs.a2[r] = svfCoeffs.a3[r] = svfCoeffs.gain[r] = Bank (0.0f);
+            svfCoeffs.k[r] = svfCoeffs.a1[r] = Bank (1.0f);
+        }
+    }
+
+    /**
+        The SVF coefficients from the sine and cosine of the prewarp angle.
+        With g = s / c, a1 = 1 / (1 + g (g + k)) becomes c^2 / (c^2 + s (s + k c)),
+        so the tan() costs no division of its own and cannot blow up near Nyquist.
+    */
+    template <typename Type>
+    static void svfFromSinCos (Type s, Type c, Type k, Type& a1, Type& a2, Type& a3) noexcept
+    {
+        const Type scale = Lanes<Type>::divide (Type (1.0f), c * c + s * (s + k * c));
+        a1 = c * c * scale;
+        a2 = s * c * scale;
+        a3 = s * s * scale;
+    }
+
+    void calculateCoefficients() noexcept
+    {
+        // The formant sum is averaged, split into chest and throat (the throat
+        // boosted by the constriction) and scaled by the wet mix; all of that is
+        // one gain per formant, applied through b0
+        const float wet = mix * (chestResonance + (1.0f - chestResonance) * (1.0f + throatConstriction * 0.5f))
+                              / static_cast<float> (numFormants);
+
+        clearCoefficients();
+
+        if (sizeTable != nullptr)
+        {
+            calculateTableCoefficients (wet);
+            return;
+        }
+
+        if (engine == FormantEngine::StateVariable)
+        {
+            calculateSvfCoefficients (wet);
+            return;
+        }
+
+        for (int i = 0; i < numFormants; ++i)
+        {
+            float freq = smoothedFreqs[i];
+            float Q = smoothedQs[i];
+
+            // Calculate bandpass coefficients
+            float omega = 2.0f * juce::MathConstants<float>::pi * freq / static_cast<float>(sampleRate);
+            float alpha = FastMath::sin(omega) / (2.0f * Q);
+            float a0 = 1.0f + alpha;
+
+            // Normalize
+            setCoefficient (coeffs.b0, i, alpha / a0 * formantGains[i] * wet);
+            setCoefficient (coeffs.a1, i, -2.0f * FastMath::cos(omega) / a0);
+            setCoefficient (coeffs.a2, i, (1.0f - alpha) / a0);
+        }
+    }
+
+    void calculateSvfCoefficients (float wet) noexcept
+    {
+        for (int i = 0; i < numFormants; ++i)
+        {
+            const float warp = juce::MathConstants<float>::pi * smoothedFreqs[i] / static_cast<float> (sampleRate);
+            setSvfFormant (i, warp, 1.0f / smoothedQs[i], formantGains[i] * wet);
+        }
+    }
+
+    void setSvfFormant (int formant, float warp, float k, float gain) noexcept
+    {
+        warp = juce::jmin (maxWarp, warp);
+
+        float sinWarp, cosWarp, a1, a2, a3;
+        FastMath::sinCosQuarterTurn (warp, sinWarp, cosWarp);
+        svfFromSinCos (sinWarp, cosWarp, k, a1, a2, a3);
+
+        setCoefficient (svfCoeffs.warp, formant, warp);
+        setCoefficient (svfCoeffs.k, formant, k);
+        setCoefficient (svfCoeffs.a1, formant, a1);
+        setCoefficient (svfCoeffs.a2, formant, a2);
+        setCoefficient (svfCoeffs.a3, formant, a3);
+        setCoefficient (svfCoeffs.gain, formant, k * gain);
+    }
+
+    /** Each voice lane interpolates its own size from the table; no trig for the biquads. */
+    void calculateTableCoefficients (float wet) noexcept
+    {
+        FormantSizeTable::Coefficients c;
+
+        if constexpr (formantsInLanes)
+        {
+            sizeTable->lookup<numFormants> (lanePositions[0], c);
+
+            for (int i = 0; i < numFormants; ++i)
+            {
+                if (engine == FormantEngine::StateVariable)
+                {
+                    setSvfFormant (i, c.warp[i], sizeTable->getK (i), formantGains[i] * wet);
+                }
+                else
+                {
+                    setCoefficient (coeffs.b0, i, c.b0[i] * formantGains[i] * wet);
+                    setCoefficient (coeffs.a1, i, c.a1[i]);
+                    setCoefficient (coeffs.a2, i, c.a2[i]);
+                }
+            }
+        }
+        else
+        {
+            // Gathered per formant across the voice lanes, then loaded a whole register at a time
+            alignas (cacheLineSize) float b0[numFormants][numVoiceLanes];
+            alignas (cacheLineSize) float a1[numFormants][numVoiceLanes];
+            alignas (cacheLineSize) float a2[numFormants][numVoiceLanes];
+            alignas (cacheLineSize) float warp[numFormants][numVoiceLanes];
+
+            for (int lane = 0; lane < numVoiceLanes; ++lane)
+            {
+                sizeTable->lookup<numFormants> (lanePositions[lane], c);
+
+                for (int i = 0; i < numFormants; ++i)
+                {
+                    b0[i][lane] = c.b0[i];
+                    a1[i][lane] = c.a1[i];
+                    a2[i][lane] = c.a2[i];
+                    warp[i][lane] = c.warp[i];
+                }
+            }
+
+            for (int i = 0; i < numFormants; ++i)
+            {
+                const float gain = formantGains[i] * wet;
+
+                if (engine == FormantEngine::StateVariable)
+                {
+                    const Bank k (sizeTable->getK (i));
+                    const Bank w = Lanes<Bank>::min (Lanes<Bank>::load (warp[i]), Bank (maxWarp));
+
+                    Bank sinWarp, cosWarp;
+                    FastMath::sinCosQuarterTurn (w, sinWarp, cosWarp);
+                    svfFromSinCos (sinWarp, cosWarp, k, svfCoeffs.a1[i], svfCoeffs.a2[i], svfCoeffs.a3[i]);
+
+                    svfCoeffs.warp[i] = w;
+                    svfCoeffs.k[i] = k;
+                    svfCoeffs.gain[i] = k * gain;
+                }
+                else
+                {
+                    coeffs.b0[i] = Lanes<Bank>::load (b0[i]) * gain;
+                    coeffs.a1[i] = Lanes<Bank>::load (a1[i]);
+                    coeffs.a2[i] = Lanes<Bank>::load (a2[i]);
+                }
+            }
+        }
+    }
+
+    static SampleType sumFormants (Bank sum) noexcept
+    {
+        if constexpr (formantsInLanes)
+            return Lanes<Bank>::sum (sum);
+        else
+            return sum;
+    }
+
+    /** One TPT SVF step; returns the band output. */
+    static Bank svfStep (Bank input, Bank a1, Bank a2, Bank a3, Bank& ic1eq, Bank& ic2eq) noexcept
+    {
+        const Bank v3 = input - ic2eq;
+        const Bank v1 = a1 * ic1eq + a2 * v3;
+        const Bank v2 = ic2eq + a2 * ic1eq + a3 * v3;
+        ic1eq = v1 + v1 - ic1eq;
+        ic2eq = v2 + v2 - ic2eq;
+        return v1;
+    }
+
+    static SampleType processSvf (SampleType input, const SvfCoefficients& c, BankState& st) noexcept
+    {
+        const Bank bankInput = Bank (input);
+        Bank sum (0.0f);
+
+        for (int r = 0; r < numRegisters; ++r)
+            sum += c.gain[r] * svfStep (bankInput, c.a1[r], c.a2[r], c.a3[r], st.s1[r], st.s2[r]);
+
+        return sumFormants (sum) + input * c.dry;
+    }
+
+    /** processSvf() with every cutoff scaled by multiplier, recomputing the coefficients for this sample. */
+    static SampleType processSvfModulated (SampleType input, SampleType multiplier, const SvfCoefficients& c, BankState& st) noexcept
+    {
+        const Bank bankInput = Bank (input);
+        const Bank bankMultiplier = Bank (multiplier);
+        Bank sum (0.0f);
+
+        for (int r = 0; r < numRegisters; ++r)
+        {
+            const Bank warp = Lanes<Bank>::clamp (c.warp[r] * bankMultiplier, 0.0f, maxWarp);
+
+            Bank sinWarp, cosWarp, a1, a2, a3;
+            FastMath::sinCosQuarterTurn (warp, sinWarp, cosWarp);
+            svfFromSinCos (sinWarp, cosWarp, c.k[r], a1, a2, a3);
+
+            sum += c.gain[r] * svfStep (bankInput, a1, a2, a3, st.s1[r], st.s2[r]);
+        }
+
+        return sumFormants (sum) + input * c.dry;
+    }
+
+    static SampleType processSample (SampleType input, const BankCoefficients& c, BankState& st) noexcept
+    {
+        const Bank bandInput = Bank (input - st.x2);
+        st.x2 = st.x1;
+        st.x1 = input;
+
+        Bank sum (0.0f);
 
+        for (int r = 0; r < numRegisters; ++r)
+        {
+            // y1 enters last, so the sample-to-sample dependency is one multiply and one subtract
+            const Bank output = c.b0[r] * bandInput - c.a2[r] * st.s2[r] - c.a1[r] * st.s1[r];
+            st.s2[r] = st.s1[r];
+            st.s1[r] = output;
+            sum += output;
+        }
+
+        return sumFormants (sum) + input * c.dry;
+    }
+
+    //==============================================================================
     double sampleRate;
     float chestResonance;
     float throatConstriction;
+    float mix = 1.0f;
     float formantFreqs[numFormants];
     float formantQs[numFormants];
-    float formantGains[numFormants] = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
-    FormantState formantStates[numFormants];
+    float smoothedFreqs[numFormants];
+    float smoothedQs[numFormants];
+    float smoothingCoefficient = 1.0f;
+    int samplesUntilUpdate = controlInterval;
+    bool isSmoothing = false;
+    float formantGains[numFormants];
+
+    FormantEngine engine = FormantEngine::Biquad;
+    const FormantSizeTable* sizeTable = nullptr;
+    float lanePositions[numVoiceLanes] = {};
+    float laneTargets[numVoiceLanes] = {};
+    BankCoefficients coeffs;
+    SvfCoefficients svfCoeffs;
+    BankState state;
 
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ResonanceSystem)
 };
 
+//==============================================================================
+/**
+    A ResonanceSystem whose formant count is chosen at run time, from 1 to
+    maxFormants: it holds whichever specialisation is in use, so a small
+    creature pays for two or three filters and a dragon gets eight. Calls are
+    dispatched once each, so per-sample work runs in the unrolled
+    specialisation.
+
+    setNumFormants() swaps the specialisation, carrying over the sample rate,
+    engine, size table, lane sizes and gains but not per-formant Hz settings.
+    It destroys the old filters, so it must not run while another thread is
+    processing.
+*/
+template <typename SampleType>
+class ResonanceSystemVariant
+{
+public:
+    ResonanceSystemVariant()
+    {
+        for (auto& size : laneSizes)
+            size = 10.0f;
+
+        setNumFormants (5);
+    }
+
+    void setNumFormants (int newNumFormants)
+    {
+        newNumFormants = juce::jlimit (1, maxFormants, newNumFormants);
+
+        if (newNumFormants == getNumFormants())
+            return;
+
+        emplace (newNumFormants, std::make_integer_sequence<int, maxFormants>());
+
+        visit ([this] (auto& r)
+        {
+            r.setEngine (engine);
+            r.setChestResonance (chestResonance);
+            r.setThroatConstriction (throatConstriction);
+            r.setMix (mix);
+
+            for (size_t lane = 0; lane < numVoiceLanes; ++lane)
+                r.setLaneSize (lane, laneSizes[lane]);
+
+            r.prepare (sampleRate);
+            r.setSizeTable (sizeTable);
+        });
+    }
+
+    int getNumFormants() const noexcept
+    {
+        return static_cast<int> (systems.index()) + 1;
+    }
+
+    void prepare (double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        visit ([=] (auto& r) { r.prepare (newSampleRate); });
+    }
+
+    void setEngine (FormantEngine newEngine)
+    {
+        engine = newEngine;
+        visit ([=] (auto& r) { r.setEngine (newEngine); });
+    }
+
+    void setSizeTable (const FormantSizeTable* newTable) noexcept
+    {
+        sizeTable = newTable;
+        visit ([=] (auto& r) { r.setSizeTable (newTable); });
+    }
+
+    void setLaneSize (size_t lane, float sizeFeet) noexcept
+    {
+        laneSizes[lane] = sizeFeet;
+        visit ([=] (auto& r) { r.setLaneSize (lane, sizeFeet); });
+    }
+
+    void setChestResonance (float newChest)
+    {
+        chestResonance = newChest;
+        visit ([=] (auto& r) { r.setChestResonance (newChest); });
+    }
+
+    void setThroatConstriction (float constriction)
+    {
+        throatConstriction = constriction;
+        visit ([=] (auto& r) { r.setThroatConstriction (constriction); });
+    }
+
+    void setMix (float newMix)
+    {
+        mix = newMix;
+        visit ([=] (auto& r) { r.setMix (newMix); });
+    }
+
+    /** Formants past getNumFormants() are ignored. */
+    void setFormantFrequency (int index, float freq)
+    {
+        visit ([=] (auto& r) { r.setFormantFrequency (index, freq); });
+    }
+
+    void setFormantQ (int index, float q)
+    {
+        visit ([=] (auto& r) { r.setFormantQ (index, q); });
+    }
+
+    SampleType process (SampleType input) noexcept
+    {
+        return visit ([=] (auto& r) { return r.process (input); });
+    }
+
+    void processBlock (SampleType* output, const SampleType* input, int numSamples) noexcept
+    {
+        visit ([=] (auto& r) { r.processBlock (output, input, numSamples); });
+    }
+
+    void processBlock (SampleType* output, const SampleType* input, const SampleType* frequencyMultipliers, int numSamples) noexcept
+    {
+        visit ([=] (auto& r) { r.processBlock (output, input, frequencyMultipliers, numSamples); });
+    }
+
+    void reset() noexcept
+    {
+        visit ([] (auto& r) { r.reset(); });
+    }
+
+    void resetLane (size_t lane) noexcept
+    {
+        visit ([=] (auto& r) { r.resetLane (lane); });
+    }
+
+private:
+    //==============================================================================
+    static constexpr size_t numVoiceLanes = std::is_same_v<SampleType, float> ? 1 : Lanes<SampleType>::size;
+
+    template <int... Indices>
+    struct SystemsFor
+    {
+        using Type = std::variant<ResonanceSystem<SampleType, Indices + 1>...>;
+    };
+
+    template <int... Indices>
+    static SystemsFor<Indices...> systemsFor (std::integer_sequence<int, Indices...>);
+
+    using Systems = typename decltype (systemsFor (std::make_integer_sequence<int, maxFormants>()))::Type;
+
+    template <int... Indices>
+    void emplace (int count, std::integer_sequence<int, Indices...>)
+    {
+        ((count == Indices + 1 ? (void) systems.template emplace<Indices>() : (void) 0), ...);
+    }
+
+    template <typename Function>
+    decltype (auto) visit (Function&& function)
+    {
+        return std::visit (std::forward<Function> (function), systems);
+    }
+
+    //==============================================================================
+    Systems systems;
+    double sampleRate = 48000.0;
+    FormantEngine engine = FormantEngine::Biquad;
+    const FormantSizeTable* sizeTable = nullptr;
+    float laneSizes[numVoiceLanes];
+    float chestResonance = 0.6f;
+    float throatConstriction = 0.4f;
+    float mix = 1.0f;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ResonanceSystemVariant)
+};
+
 } // namespace DSP
 } // namespace Growl
@@ -0,0 +1,193 @@
+/*
+  ==============================================================================
+
+    SIMDLanes.h
+    Created: 17 Oct 2026 11:00:00am
+    Author:  White Room Audio
+
+    Helpers for running DSP code either on plain floats or on SIMD registers
+    holding one voice per lane, plus the memory layout constants that go with it.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace Growl {
+namespace DSP {
+
+/** Alignment used to keep per-voice and per-thread state off each other's cache lines. */
+static constexpr size_t cacheLineSize = 64;
+
+//==============================================================================
+/**
+    Sample type used to render several voices per instruction.
+    Falls back to scalar processing when JUCE has no SIMD support for the target.
+*/
+#if JUCE_USE_SIMD
+using VoiceLanes = juce::dsp::SIMDRegister<float>;
+#else
+using VoiceLanes = float;
+#endif
+
+//==============================================================================
+/**
+    Per-lane operations that juce::dsp::SIMDRegister does not provide directly,
+    with a scalar specialisation so templated DSP code reads the same for both.
+*/
+template <typename SampleType>
+struct Lanes
+{
+    static constexpr size_t size = 1;
+
+    /** The raw IEEE bits of every lane, for code that works on exponent fields. */
+    using Bits = std::array<int32_t, size>;
+
+    static float get (SampleType v, size_t) noexcept                    { return v; }
+    static void set (SampleType& v, size_t, float value) noexcept       { v = value; }
+    static float sum (SampleType v) noexcept                            { return v; }
+
+    /** One value per lane from an array aligned like SampleType. */
+    static SampleType load (const float* values) noexcept               { return *values; }
+
+    static SampleType min (SampleType a, SampleType b) noexcept         { return juce::jmin (a, b); }
+    static SampleType max (SampleType a, SampleType b) noexcept         { return juce::jmax (a, b); }
+    static SampleType divide (SampleType a, SampleType b) noexcept      { return a / b; }
+
+    static SampleType clamp (SampleType v, float lo, float hi) noexcept
+    {
+        return juce::jlimit (lo, hi, v);
+    }
+
+    /** Wraps a phase in [0, 2) back into [0, 1). */
+    static SampleType wrapPhase (SampleType phase) noexcept
+    {
+        return phase >= 1.0f ? phase - 1.0f : phase;
+    }
+
+    /** Rounds towards zero, which is the floor for the non-negative phases it is used on. */
+    static SampleType truncate (SampleType v) noexcept                  { return static_cast<float> (static_cast<int32_t> (v)); }
+
+    /** 0, 1, 2... across the lanes. */
+    static SampleType laneIndices() noexcept                            { return 0.0f; }
+
+    /** v with the lanes below first cleared. */
+    static SampleType fromLane (SampleType v, size_t first) noexcept    { return first == 0 ? v : 0.0f; }
+
+    static SampleType loadUnaligned (const float* values) noexcept      { return *values; }
+    static void storeUnaligned (SampleType v, float* values) noexcept   { *values = v; }
+
+    static Bits toBits (SampleType v) noexcept                          { return std::bit_cast<Bits> (v); }
+    static SampleType fromBits (Bits bits) noexcept                     { return std::bit_cast<SampleType> (bits); }
+
+    /** Applies a scalar function to every lane. */
+    template <typename Function>
+    static SampleType map (SampleType v, Function&& fn) noexcept
+    {
+        return fn (v);
+    }
+};
+
+#if JUCE_USE_SIMD
+template <>
+struct Lanes<juce::dsp::SIMDRegister<float>>
+{
+    using Register = juce::dsp::SIMDRegister<float>;
+
+    static constexpr size_t size = Register::SIMDNumElements;
+
+    using Bits = std::array<int32_t, size>;
+
+    static float get (Register v, size_t lane) noexcept                 { return v.get (lane); }
+    static void set (Register& v, size_t lane, float value) noexcept    { v.set (lane, value); }
+    static float sum (Register v) noexcept                              { return v.sum(); }
+    static Register load (const float* values) noexcept                 { return Register::fromRawArray (values); }
+
+    static Register min (Register a, Register b) noexcept               { return Register::min (a, b); }
+    static Register max (Register a, Register b) noexcept               { return Register::max (a, b); }
+
+    /** SIMDRegister has no division; a fixed-size lane loop that the compiler can vectorise. */
+    static Register divide (Register a, Register b) noexcept
+    {
+        alignas (Register::SIMDRegisterSize) float numerators[size];
+        alignas (Register::SIMDRegisterSize) float denominators[size];
+        a.copyToRawArray (numerators);
+        b.copyToRawArray (denominators);
+
+        for (size_t i = 0; i < size; ++i)
+            numerators[i] /= denominators[i];
+
+        return Register::fromRawArray (numerators);
+    }
+
+    static Register clamp (Register v, float lo, float hi) noexcept
+    {
+        return Register::min (Register::max (v, Register::expand (lo)), Register::expand (hi));
+    }
+
+    /** Wraps a phase in [0, 2) back into [0, 1) without branching. */
+    static Register wrapPhase (Register phase) noexcept
+    {
+        const auto one = Register::expand (1.0f);
+        return phase - (one & Register::greaterThanOrEqual (phase, one));
+    }
+
+    static Register truncate (Register v) noexcept                      { return Register::truncate (v); }
+
+    static Register laneIndices() noexcept
+    {
+        alignas (Register::SIMDRegisterSize) float indices[size];
+
+        for (size_t i = 0; i < size; ++i)
+            indices[i] = static_cast<float> (i);
+
+        return Register::fromRawArray (indices);
+    }
+
+    static Register fromLane (Register v, size_t first) noexcept
+    {
+        return v & Register::greaterThanOrEqual (laneIndices(), Register::expand (static_cast<float> (first)));
+    }
+
+    static Register loadUnaligned (const float* values) noexcept
+    {
+        alignas (Register::SIMDRegisterSize) float lanes[size];
+        std::copy_n (values, size, lanes);
+        return Register::fromRawArray (lanes);
+    }
+
+    static void storeUnaligned (Register v, float* values) noexcept
+    {
+        alignas (Register::SIMDRegisterSize) float lanes[size];
+        v.copyToRawArray (lanes);
+        std::copy_n (lanes, size, values);
+    }
+
+    /** Reinterprets the register in place; loops over Bits compile to vector integer ops. */
+    static Bits toBits (Register v) noexcept                            { return std::bit_cast<Bits> (v); }
+    static Register fromBits (Bits bits) noexcept                       { return std::bit_cast<Register> (bits); }
+
+    /** Applies a scalar function to every lane, for shapers with no vector form. */
+    template <typename Function>
+    static Register map (Register v, Function&& fn) noexcept
+    {
+        alignas (Register::SIMDRegisterSize) float values[size];
+        v.copyToRawArray (values);
+
+        for (auto& value : values)
+            value = fn (value);
+
+        return Register::fromRawArray (values);
+    }
+};
+#endif
+
+} // namespace DSP
+} // namespace Growl
@@ -15,6 +15,7 @@
 
 #include <juce_dsp/juce_dsp.h>
 #include <juce_audio_basics/juce_audio_basics.h>
+#include "FastMath.h"
 
 namespace Growl {
 namespace DSP {
@@ -90,7 +91,7 @@ private:
         }
 
         pitchMultiplier = scale;
-        formantMultiplier = std::pow(scale, 0.8f);
+        formantMultiplier = FastMath::pow(scale, 0.8f);
         resonanceMultiplier = std::sqrt(scale);
         brightnessMultiplier = 1.0f / std::sqrt(scale);
     }
@@ -102,25 +103,25 @@ private:
 
     float calculateLogScale() const
     {
-        return std::log2(juce::jmax(1.0f, currentSize / 5.0f));
+        return FastMath::log2(juce::jmax(1.0f, currentSize / 5.0f));
     }
 
     float calculateExpScale() const
     {
         auto normalizedSize = currentSize / 10.0f;
-        return std::pow(normalizedSize, -0.5f);
+        return FastMath::pow(normalizedSize, -0.5f);
     }
 
     float calculateAllometricScale() const
     {
         auto normalizedSize = currentSize / 10.0f;
-        return std::pow(normalizedSize, -1.0f);
+        return FastMath::pow(normalizedSize, -1.0f);
     }
 
     float calculateFrequencyScale() const
     {
         auto normalizedSize = currentSize / 10.0f;
-        return std::pow(normalizedSize, -0.8f);
+        return FastMath::pow(normalizedSize, -0.8f);
     }
 
     //==============================================================================
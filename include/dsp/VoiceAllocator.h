@@ -0,0 +1,96 @@
+/*
+  ==============================================================================
+
+    VoiceAllocator.h
+    Created: 17 Oct 2026 1:00:00pm
+    Author:  White Room Audio
+
+    Constant-time voice allocation for the polyphonic engine.
+    Keeps a free list of voice slots and a note-to-voice table so note-on and
+    note-off never scan the voice pool.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <cstdint>
+
+namespace Growl {
+namespace DSP {
+
+template <int Capacity>
+class VoiceAllocator
+{
+public:
+    static constexpr int numNotes = 128;
+
+    VoiceAllocator()
+    {
+        reset();
+    }
+
+    ~VoiceAllocator() = default;
+
+    /** Marks every voice free and forgets all notes. */
+    void reset() noexcept
+    {
+        // Voice 0 is handed out first so that low SIMD lane groups fill up first
+        for (int i = 0; i < Capacity; ++i)
+            freeVoices[static_cast<size_t> (i)] = static_cast<int16_t> (Capacity - 1 - i);
+
+        numFree = Capacity;
+        noteToVoice.fill (-1);
+    }
+
+    /** Pops a free voice, or returns -1 when every voice is busy. */
+    int allocate() noexcept
+    {
+        return numFree > 0 ? freeVoices[static_cast<size_t> (--numFree)] : -1;
+    }
+
+    /** Returns a voice that has finished sounding to the free list. */
+    void release (int voice) noexcept
+    {
+        jassert (numFree < Capacity);
+        freeVoices[static_cast<size_t> (numFree++)] = static_cast<int16_t> (voice);
+    }
+
+    int getNumFree() const noexcept
+    {
+        return numFree;
+    }
+
+    /** The voice currently held by a note, or -1. */
+    int getVoiceForNote (int noteNumber) const noexcept
+    {
+        return juce::isPositiveAndBelow (noteNumber, numNotes) ? noteToVoice[static_cast<size_t> (noteNumber)] : -1;
+    }
+
+    void mapNote (int noteNumber, int voice) noexcept
+    {
+        if (juce::isPositiveAndBelow (noteNumber, numNotes))
+            noteToVoice[static_cast<size_t> (noteNumber)] = static_cast<int16_t> (voice);
+    }
+
+    /** Forgets a note, but only if it still points at this voice. */
+    void unmapNote (int noteNumber, int voice) noexcept
+    {
+        if (getVoiceForNote (noteNumber) == voice)
+            noteToVoice[static_cast<size_t> (noteNumber)] = -1;
+    }
+
+private:
+    //==============================================================================
+    std::array<int16_t, Capacity> freeVoices {};
+    std::array<int16_t, numNotes> noteToVoice {};
+    int numFree = 0;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (VoiceAllocator)
+};
+
+} // namespace DSP
+} // namespace Growl
@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    VoicePool.h
+    Created: 17 Oct 2026 10:00:00am
+    Author:  White Room Audio
+
+    Struct-of-arrays storage for per-voice DSP state.
+    Every voice owns its noise, oscillator, formant, distortion and envelope
+    state; each kind of state lives in its own cache-line aligned array.
+    Formant, distortion and pink noise state is packed one voice per SIMD lane.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include "NoiseGenerator.h"
+#include "OscillatorBank.h"
+#include "ResonanceSystem.h"
+#include "DistortionStage.h"
+#include "ModulationSystem.h"
+#include "SIMDLanes.h"
+
+namespace Growl {
+namespace DSP {
+
+//==============================================================================
+/**
+    Memory used by one voice, broken down per DSP stage.
+*/
+struct VoiceFootprint
+{
+    size_t voiceInfo = 0;     // active flag, note, velocity, age, levels
+    size_t noise = 0;         // including a share of the lane group's noise
+    size_t oscillator = 0;
+    size_t resonance = 0;     // share of a lane group
+    size_t distortion = 0;    // share of a lane group
+    size_t envelope = 0;
+
+    size_t perVoice = 0;      // sum of the above
+    size_t poolTotal = 0;     // whole pool including alignment padding
+    int numVoices = 0;
+};
+
+//==============================================================================
+/**
+    Fixed-capacity pool of voices laid out as a struct of arrays.
+
+    Each stage of the voice chain is stored contiguously for all voices, so a
+    stage can be run across the pool by walking one array. Arrays start on a
+    cache line so that the hot state of neighbouring stages never shares one.
+
+    Formants, distortion and the group noise are stored per group of
+    laneWidth voices: voice v lives in lane (v % laneWidth) of group
+    (v / laneWidth), so these stages run a whole group per instruction.
+*/
+template <int Capacity>
+struct VoicePool
+{
+    static constexpr int capacity = Capacity;
+    static constexpr int laneWidth = static_cast<int> (Lanes<VoiceLanes>::size);
+    static constexpr int numGroups = Capacity / laneWidth;
+
+    static_assert (Capacity % laneWidth == 0, "Voice capacity must be a multiple of the SIMD width");
+
+    static constexpr int groupOf (int voice) noexcept           { return voice / laneWidth; }
+    static constexpr size_t laneOf (int voice) noexcept         { return static_cast<size_t> (voice % laneWidth); }
+
+    // Voice bookkeeping
+    alignas (cacheLineSize) std::array<bool, Capacity> active {};
+    alignas (cacheLineSize) std::array<int, Capacity> noteNumber {};
+    alignas (cacheLineSize) std::array<float, Capacity> velocity {};
+    alignas (cacheLineSize) std::array<float, Capacity> age {};
+    alignas (cacheLineSize) std::array<float, Capacity> level {};    // recent peak, for voice stealing
+    alignas (cacheLineSize) std::array<float, Capacity> tailLevel {};   // formant output peak before distortion, for sleep
+
+    // Per-voice DSP state
+    alignas (cacheLineSize) std::array<NoiseGenerator, Capacity> noise;
+    alignas (cacheLineSize) std::array<NoiseLanes<VoiceLanes>, numGroups> groupNoise;
+    alignas (cacheLineSize) std::array<OscillatorBank, Capacity> oscillators;
+    alignas (cacheLineSize) std::array<ResonanceSystemVariant<VoiceLanes>, numGroups> resonance;
+    alignas (cacheLineSize) std::array<DistortionStage<VoiceLanes>, numGroups> distortion;
+    alignas (cacheLineSize) std::array<Envelope, Capacity> envelopes;
+
+    static constexpr VoiceFootprint getFootprint() noexcept
+    {
+        VoiceFootprint f;
+        f.voiceInfo = sizeof (bool) + sizeof (int) + sizeof (float) + sizeof (float) + sizeof (float) + sizeof (float);
+        f.noise = sizeof (NoiseGenerator) + sizeof (NoiseLanes<VoiceLanes>) / laneWidth;
+        f.oscillator = sizeof (OscillatorBank);
+        f.resonance = sizeof (ResonanceSystemVariant<VoiceLanes>) / laneWidth;
+        f.distortion = sizeof (DistortionStage<VoiceLanes>) / laneWidth;
+        f.envelope = sizeof (Envelope);
+        f.perVoice = f.voiceInfo + f.noise + f.oscillator + f.resonance + f.distortion + f.envelope;
+        f.poolTotal = sizeof (VoicePool);
+        f.numVoices = Capacity;
+        return f;
+    }
+};
+
+} // namespace DSP
+} // namespace Growl
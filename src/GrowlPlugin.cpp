@@ -14,11 +14,7 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include "dsp/Preset.h"
 #include "dsp/FactoryPresets.h"
-#include "dsp/SizeScaler.h"
-#include "dsp/NoiseGenerator.h"
-#include "dsp/OscillatorBank.h"
-#include "dsp/ResonanceSystem.h"
-#include "dsp/DistortionStage.h"
+#include "dsp/GrowlProcessor.h"
 
 //==============================================================================
 class GrowlPlugin  : public juce::AudioProcessor
@@ -39,6 +35,7 @@ public:
         if (!factoryPresets.empty())
         {
             currentPreset = factoryPresets[0];
+            applyPresetToDSP();
         }
     }
 
@@ -48,20 +45,39 @@ public:
     void prepareToPlay (double newSampleRate, int samplesPerBlock) override
     {
         sampleRate = newSampleRate;
+        maxBlockSize = samplesPerBlock;
 
-        // Prepare DSP modules
-        sizeScaler.prepare (sampleRate);
-        noiseGenerator.prepare (sampleRate);
-        oscillatorBank.prepare (sampleRate);
-        resonanceSystem.prepare (sampleRate);
-        distortionStage.prepare (sampleRate);
+        // Prepare DSP engine (allocates all scratch buffers and oversampling filters)
+        processor.setOversampling (oversamplingFactorLog2, oversamplingFilter);
+        processor.prepare (sampleRate, samplesPerBlock);
+        applyPresetToDSP();
 
-        juce::ignoreUnused (samplesPerBlock);
+        setLatencySamples (processor.getLatencyInSamples());
+        isPrepared = true;
     }
 
     void releaseResources() override
     {
-        // Free DSP resources here
+        isPrepared = false;
+    }
+
+    /**
+        Sets the distortion oversampling quality: factorLog2 0 = off, 1 = 2x,
+        2 = 4x, 3 = 8x. Linear phase keeps the waveform shape at the cost of
+        latency; minimum phase adds only a few samples. The new latency is
+        reported to the host.
+    */
+    void setOversampling (int factorLog2, Growl::DSP::OversamplingFilter filter)
+    {
+        oversamplingFactorLog2 = juce::jlimit (0, 3, factorLog2);
+        oversamplingFilter = filter;
+
+        if (isPrepared)
+        {
+            suspendProcessing (true);
+            prepareToPlay (sampleRate, maxBlockSize);
+            suspendProcessing (false);
+        }
     }
 
     void processBlock (juce::AudioBuffer<float>& buffer,
@@ -75,58 +91,22 @@ public:
         for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
             buffer.clear (i, 0, buffer.getNumSamples());
 
-        // DSP Pipeline: NoiseGenerator -> OscillatorBank -> Mix -> ResonanceSystem -> DistortionStage
+        // DSP Pipeline (per voice): NoiseGenerator + OscillatorBank -> ResonanceSystem -> DistortionStage
         auto numSamples = buffer.getNumSamples();
 
-        // Process MIDI for note triggers
-        for (const auto metadata : midiMessages)
-        {
-            const auto message = metadata.getMessage();
-            if (message.isNoteOn())
-            {
-                // Trigger oscillator bank with MIDI note
-                auto midiNote = message.getNoteNumber();
-                auto frequency = 440.0 * std::pow(2.0, (midiNote - 69) / 12.0);
-                oscillatorBank.setFrequency(frequency);
-                oscillatorBank.setGate(true);
-            }
-            else if (message.isNoteOff())
-            {
-                oscillatorBank.setGate(false);
-            }
-        }
-
         // Get output channel (mono to stereo)
         auto* outputLeft = buffer.getWritePointer(0);
-        auto* outputRight = buffer.getWritePointer(1);
-
-        // Process each sample
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            // 1. Generate noise component
-            float noise = noiseGenerator.process();
 
-            // 2. Generate oscillator component
-            float oscillator = oscillatorBank.process();
+        // Render voices, splitting the block at each MIDI event so that notes
+        // start and stop on their exact sample rather than at the block start
+        processor.processBlock (outputLeft, numSamples, midiMessages);
 
-            // 3. Mix noise and oscillators based on preset
-            float mixed = (noise * (1.0f - currentPreset.oscillatorMix)) +
-                         (oscillator * currentPreset.oscillatorMix);
+        // Apply master gain
+        juce::FloatVectorOperations::multiply (outputLeft, masterGain, numSamples);
 
-            // 4. Apply resonance system (formants)
-            float resonant = resonanceSystem.process(mixed);
-
-            // 5. Apply distortion
-            float distorted = distortionStage.process(resonant);
-
-            // 6. Apply master gain
-            float output = distorted * currentPreset.masterGain;
-
-            // Write to output buffer (mono to stereo)
-            outputLeft[sample] = output;
-            if (totalNumOutputChannels > 1)
-                outputRight[sample] = output;
-        }
+        // Write to output buffer (mono to stereo)
+        if (totalNumOutputChannels > 1)
+            juce::FloatVectorOperations::copy (buffer.getWritePointer(1), outputLeft, numSamples);
 
         // Clear remaining channels if any
         for (int channel = 2; channel < totalNumOutputChannels; ++channel)
@@ -206,6 +186,8 @@ public:
         // Save current preset state
         juce::ValueTree state ("state");
         state.setProperty ("currentPreset", currentPresetIndex, nullptr);
+        state.setProperty ("oversampling", oversamplingFactorLog2, nullptr);
+        state.setProperty ("linearPhase", oversamplingFilter == Growl::DSP::OversamplingFilter::LinearPhase, nullptr);
 
         // Convert current preset to XML
         juce::ValueTree presetTree = currentPreset.toValueTree();
@@ -232,6 +214,14 @@ public:
                 currentPreset = PresetParameters::fromValueTree (presetTree);
                 applyPresetToDSP();
             }
+
+            const int restoredFactor = state.getProperty ("oversampling", oversamplingFactorLog2);
+            const auto restoredFilter = static_cast<bool> (state.getProperty ("linearPhase", false))
+                                          ? Growl::DSP::OversamplingFilter::LinearPhase
+                                          : Growl::DSP::OversamplingFilter::MinimumPhase;
+
+            if (restoredFactor != oversamplingFactorLog2 || restoredFilter != oversamplingFilter)
+                setOversampling (restoredFactor, restoredFilter);
         }
     }
 
@@ -257,43 +247,25 @@ private:
     */
     void applyPresetToDSP()
     {
-        // 1. Apply size scaling
-        sizeScaler.setSizeFeet (currentPreset.sizeFeet);
-        sizeScaler.setScalingType (Growl::DSP::SizeScaler::Allometric);
-
-        // 2. Apply noise settings
-        noiseGenerator.setType (static_cast<int> (currentPreset.noiseType));
-        noiseGenerator.setMix (currentPreset.noiseMix);
-
-        // 3. Apply oscillator settings
-        oscillatorBank.setType (static_cast<int> (currentPreset.oscillatorType));
-        oscillatorBank.setDetune (currentPreset.oscillatorDetune);
-        oscillatorBank.setMix (currentPreset.oscillatorMix);
-
-        // 4. Apply formant settings (with size scaling)
-        auto formantMult = sizeScaler.getFormantMultiplier();
-        for (int i = 0; i < 5; ++i)
-        {
-            auto scaledFreq = currentPreset.formantFreqs[i] * formantMult;
-            resonanceSystem.setFormant (i, scaledFreq, currentPreset.formantQs[i]);
-        }
-        resonanceSystem.setChestResonance (currentPreset.chestResonance);
-        resonanceSystem.setThroatResonance (currentPreset.throatResonance);
-        resonanceSystem.setMix (currentPreset.resonanceMix);
-
-        // 5. Apply distortion settings
-        distortionStage.setType (static_cast<int> (currentPreset.distortionType));
-        distortionStage.setDrive (currentPreset.drive);
-        distortionStage.setTone (currentPreset.tone);
+        // The size table is built and handed over without stopping the audio;
+        // setting every voice may swap the filter banks, so never mid-block
+        processor.publishPresetFormants (currentPreset);
+
+        const juce::ScopedLock lock (getCallbackLock());
+        processor.applyPresetToVoices (currentPreset);
+        masterGain = juce::Decibels::decibelsToGain (currentPreset.masterGain);
     }
 
     //==============================================================================
-    // DSP module instances - fully integrated
-    Growl::DSP::SizeScaler sizeScaler;
-    Growl::DSP::NoiseGenerator noiseGenerator;
-    Growl::DSP::OscillatorBank oscillatorBank;
-    Growl::DSP::ResonanceSystem resonanceSystem;
-    Growl::DSP::DistortionStage distortionStage;
+    // Polyphonic DSP engine - owns all per-voice DSP modules
+    Growl::DSP::GrowlProcessor processor;
+    float masterGain = 1.0f;
+
+    // Distortion oversampling: 2x minimum phase by default, cheap and low latency
+    int oversamplingFactorLog2 = 1;
+    Growl::DSP::OversamplingFilter oversamplingFilter = Growl::DSP::OversamplingFilter::MinimumPhase;
+    int maxBlockSize = 512;
+    bool isPrepared = false;
 
     // Preset management
     std::vector<PresetParameters> factoryPresets;
@@ -15,6 +15,9 @@
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 using namespace Growl::DSP;
 
@@ -27,6 +30,71 @@ void printHeader(const std::string& title)
     std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
 }
 
+bool testFastMath()
+{
+    std::cout << "\n✅ Testing FastMath...\n";
+
+    // Worst error of each approximation against the standard library, in the
+    // scalar and the voice-lane form; the bounds are the ones documented in FastMath.h
+    double sinError = 0.0, cosError = 0.0, tanhError = 0.0, exp2Error = 0.0, log2Error = 0.0, powError = 0.0;
+    bool lanesMatch = true;
+
+    for (int i = -200000; i <= 200000; ++i)
+    {
+        const float x = static_cast<float>(i) * 0.005f;   // +/-1000
+        sinError = std::max(sinError, std::abs(static_cast<double>(FastMath::sin(x)) - std::sin(static_cast<double>(x))));
+        cosError = std::max(cosError, std::abs(static_cast<double>(FastMath::cos(x)) - std::cos(static_cast<double>(x))));
+
+        const float t = static_cast<float>(i) * 0.0001f;  // +/-20
+        tanhError = std::max(tanhError, std::abs(static_cast<double>(FastMath::tanh(t)) - std::tanh(static_cast<double>(t))));
+        exp2Error = std::max(exp2Error, std::abs(FastMath::exp2(t) / std::exp2(static_cast<double>(t)) - 1.0));
+
+        const float positive = std::exp2(static_cast<float>(i) * 0.0001f);  // 2^-20 .. 2^20
+        log2Error = std::max(log2Error, std::abs(static_cast<double>(FastMath::log2(positive)) - std::log2(static_cast<double>(positive))));
+        powError = std::max(powError, std::abs(FastMath::pow(positive, 0.8f) / std::pow(static_cast<double>(positive), 0.8) - 1.0));
+
+        const VoiceLanes lanes(x * 0.01f);
+        lanesMatch = lanesMatch
+            && Lanes<VoiceLanes>::get(FastMath::sin(lanes), 0) == FastMath::sin(x * 0.01f)
+            && Lanes<VoiceLanes>::get(FastMath::tanh(lanes), 0) == FastMath::tanh(x * 0.01f);
+
+        // exp2, log2 and pow work on the lane bits, so give every lane its own exponent
+        VoiceLanes spread(0.0f), positives(0.0f);
+        for (size_t lane = 0; lane < Lanes<VoiceLanes>::size; ++lane)
+        {
+            Lanes<VoiceLanes>::set(spread, lane, t + static_cast<float>(lane) * 7.3f - 11.0f);
+            Lanes<VoiceLanes>::set(positives, lane, std::exp2(Lanes<VoiceLanes>::get(spread, lane)));
+        }
+
+        const VoiceLanes exps = FastMath::exp2(spread), logs = FastMath::log2(positives), pows = FastMath::pow(positives, 0.8f);
+        for (size_t lane = 0; lane < Lanes<VoiceLanes>::size; ++lane)
+            lanesMatch = lanesMatch
+                && Lanes<VoiceLanes>::get(exps, lane) == FastMath::exp2(Lanes<VoiceLanes>::get(spread, lane))
+                && Lanes<VoiceLanes>::get(logs, lane) == FastMath::log2(Lanes<VoiceLanes>::get(positives, lane))
+                && Lanes<VoiceLanes>::get(pows, lane) == FastMath::pow(Lanes<VoiceLanes>::get(positives, lane), 0.8f);
+    }
+
+    // sinCosQuarterTurn, as the SVF prewarp uses it: tan up to 0.48 x the sample rate
+    double quarterTurnError = 0.0, prewarpError = 0.0;
+    for (int i = 0; i <= 15000; ++i)
+    {
+        const float x = static_cast<float>(i) * 0.0001f;   // 0 .. 1.5
+        float s, c;
+        FastMath::sinCosQuarterTurn(x, s, c);
+        quarterTurnError = std::max({ quarterTurnError, std::abs(s - std::sin(static_cast<double>(x))), std::abs(c - std::cos(static_cast<double>(x))) });
+        prewarpError = std::max(prewarpError, std::abs(static_cast<double>(s) / c / std::tan(static_cast<double>(x)) - 1.0));
+    }
+
+    std::cout << "   Max error: sin " << sinError << ", cos " << cosError << ", tanh " << tanhError
+              << ", exp2 (rel) " << exp2Error << ", log2 " << log2Error << ", pow (rel) " << powError << "\n";
+    std::cout << "   Quarter-turn sin/cos " << quarterTurnError << ", tan from them (rel) " << prewarpError << "\n";
+    std::cout << "   Voice-lane forms match scalar: " << (lanesMatch ? "yes" : "NO") << "\n";
+
+    // pow: 20 * 0.8 = 16 octaves, so 4e-7 + 1.4e-7 * 16
+    return sinError < 6.0e-7 && cosError < 6.0e-7 && tanhError < 1.0e-5 && exp2Error < 4.0e-7
+        && log2Error < 2.0e-7 && powError < 2.7e-6 && quarterTurnError < 6.0e-7 && prewarpError < 2.0e-6 && lanesMatch;
+}
+
 bool testNoiseGenerator()
 {
     std::cout << "\n✅ Testing NoiseGenerator...\n";
@@ -45,6 +113,82 @@ bool testNoiseGenerator()
     float average = sum / 1000.0f;
     std::cout << "   Pink noise average: " << average << "\n";
 
+    // Pink spectrum: per-bin power should fall 3 dB per octave, i.e. about
+    // 12 dB from the 32-64 bin octave to the 512-1024 bin octave
+    {
+        constexpr int frameSize = 2048, numFrames = 16;
+        std::vector<float> frame(frameSize), twiddleCos(frameSize), twiddleSin(frameSize);
+        for (int n = 0; n < frameSize; ++n)
+        {
+            twiddleCos[n] = std::cos(2.0 * M_PI * n / frameSize);
+            twiddleSin[n] = std::sin(2.0 * M_PI * n / frameSize);
+        }
+
+        const auto octavePower = [&](int lowBin)
+        {
+            double power = 0.0;
+            for (int k = lowBin; k < 2 * lowBin; ++k)
+            {
+                double re = 0.0, im = 0.0;
+                for (int n = 0; n < frameSize; ++n)
+                {
+                    re += frame[n] * twiddleCos[(k * n) % frameSize];
+                    im += frame[n] * twiddleSin[(k * n) % frameSize];
+                }
+                power += re * re + im * im;
+            }
+            return power / lowBin;
+        };
+
+        NoiseGenerator pink;
+        pink.setNoiseType(NoiseGenerator::Pink);
+        double low = 0.0, high = 0.0;
+        for (int f = 0; f < numFrames; ++f)
+        {
+            pink.processBlock(frame.data(), frameSize);
+            low += octavePower(32);
+            high += octavePower(512);
+        }
+
+        const double dropDb = 10.0 * std::log10(low / high);
+        std::cout << "   Pink noise drop over 4 octaves: " << dropDb << " dB (expected 12)\n";
+
+        // A voice group's pink noise: every lane is pink on its own and
+        // independent of its neighbour
+        constexpr int numLanes = NoiseLanes<VoiceLanes>::numLanes;
+        NoiseLanes<VoiceLanes> group;
+        group.setSeed(42);
+        std::vector<VoiceLanes> groupFrame(frameSize);
+        double laneLow = 0.0, laneHigh = 0.0, cross = 0.0, power0 = 0.0, power1 = 0.0;
+        for (int f = 0; f < numFrames; ++f)
+        {
+            group.processBlock(groupFrame.data(), frameSize);
+            for (int n = 0; n < frameSize; ++n)
+            {
+                const float a = Lanes<VoiceLanes>::get(groupFrame[n], 0);
+                const float b = Lanes<VoiceLanes>::get(groupFrame[n], numLanes > 1 ? 1 : 0);
+                frame[n] = Lanes<VoiceLanes>::get(groupFrame[n], numLanes - 1);
+                cross += a * b;
+                power0 += a * a;
+                power1 += b * b;
+            }
+            laneLow += octavePower(32);
+            laneHigh += octavePower(512);
+        }
+
+        const double laneDropDb = 10.0 * std::log10(laneLow / laneHigh);
+        const double laneCorrelation = cross / std::sqrt(power0 * power1);
+        std::cout << "   Pink noise in " << numLanes << " voice lanes: drop " << laneDropDb
+                  << " dB, lane correlation " << laneCorrelation << "\n";
+
+        if (std::abs(dropDb - 12.0) > 2.0 || std::abs(laneDropDb - 12.0) > 2.0
+            || (numLanes > 1 && std::abs(laneCorrelation) > 0.2))
+        {
+            std::cout << "❌ Pink noise spectrum is not -3 dB/octave\n";
+            return false;
+        }
+    }
+
     // Test all noise types
     noise.setNoiseType(NoiseGenerator::White);
     float white = noise.process();
@@ -54,6 +198,169 @@ bool testNoiseGenerator()
     float brown = noise.process();
     std::cout << "   Brown noise sample: " << brown << "\n";
 
+    // Per-instance generator: same seed gives the same noise, block and
+    // per-sample draws agree, and the output is uniform on [-1, 1)
+    RandomLanes a, b, c;
+    a.setSeed(42);
+    b.setSeed(42);
+    c.setSeed(43);
+
+    std::vector<float> block(1003);
+    a.fill(block.data(), 3);
+    a.fill(block.data() + 3, 1000);
+
+    bool reproducible = true, seedsDiffer = false;
+    double mean = 0.0, meanSquare = 0.0;
+    for (float value : block)
+    {
+        reproducible = reproducible && value == b.next();
+        seedsDiffer = seedsDiffer || value != c.next();
+        mean += value;
+        meanSquare += value * value;
+    }
+
+    mean /= static_cast<double> (block.size());
+    meanSquare /= static_cast<double> (block.size());
+    std::cout << "   RandomLanes reproducible: " << (reproducible ? "yes" : "NO")
+              << ", mean " << mean << ", mean square " << meanSquare << " (uniform: 0.333)\n";
+
+    if (! reproducible || ! seedsDiffer || std::abs(mean) > 0.05 || std::abs(meanSquare - 1.0 / 3.0) > 0.03)
+    {
+        std::cout << "❌ RandomLanes not reproducible or not uniform\n";
+        return false;
+    }
+
+    // Block kernels: single colours match per-sample rendering, and a mix
+    // with zero weights renders only the generators it uses
+    bool blocksMatch = true;
+    for (auto type : { NoiseGenerator::White, NoiseGenerator::Pink, NoiseGenerator::Brown, NoiseGenerator::Bandpass })
+    {
+        NoiseGenerator perSample, perBlock;
+        perSample.setNoiseType(type);
+        perBlock.setNoiseType(type);
+
+        std::vector<float> rendered(515);
+        perBlock.processBlock(rendered.data(), 512);
+        perBlock.processBlock(rendered.data() + 512, 3);
+
+        for (float value : rendered)
+            blocksMatch = blocksMatch && std::abs(value - perSample.process()) < 1e-6f;
+    }
+
+    NoiseGenerator whiteOnly;
+    RandomLanes reference;
+    whiteOnly.setNoiseType(NoiseGenerator::CustomMix);
+    whiteOnly.setMixWeights(0.5f, 0.0f, 0.0f);
+
+    std::vector<float> mixed(300);
+    whiteOnly.processBlock(mixed.data(), 300);
+
+    bool skipsZeroWeights = true;
+    for (float value : mixed)
+        skipsZeroWeights = skipsZeroWeights && std::abs(value - 0.5f * reference.next()) < 1e-6f;
+
+    std::cout << "   Block kernels match per-sample: " << (blocksMatch ? "yes" : "NO")
+              << ", zero-weight generators skipped: " << (skipsZeroWeights ? "yes" : "NO") << "\n";
+
+    if (! blocksMatch || ! skipsZeroWeights)
+    {
+        std::cout << "❌ Noise block kernels disagree with per-sample rendering\n";
+        return false;
+    }
+
+    // Band-pass noise is set in Hz: with a Q of 4 at 1 kHz, the noise at
+    // 500 Hz and 2 kHz sits about 15.7 dB down at any sample rate, and the
+    // level stays close to 1/3 RMS
+    bool bandInPlace = true;
+    for (double rate : { 48000.0, 96000.0 })
+    {
+        NoiseGenerator bandpass;
+        bandpass.prepare(rate);
+        bandpass.setNoiseType(NoiseGenerator::Bandpass);
+        bandpass.setBandpassBand(1000.0f, 4.0f);
+
+        const int frameSize = static_cast<int> (rate / 20.0);
+        std::vector<float> frame(static_cast<size_t> (frameSize));
+        double power[3] = {}, total = 0.0;
+        const double probes[3] = { 500.0, 1000.0, 2000.0 };
+
+        for (int f = 0; f < 200; ++f)
+        {
+            bandpass.processBlock(frame.data(), frameSize);
+
+            for (int p = 0; p < 3; ++p)
+            {
+                // Goertzel power at the probe frequency
+                const double coefficient = 2.0 * std::cos(2.0 * M_PI * probes[p] / rate);
+                double s1 = 0.0, s2 = 0.0;
+                for (float x : frame)
+                {
+                    const double s0 = x + coefficient * s1 - s2;
+                    s2 = s1;
+                    s1 = s0;
+                }
+                power[p] += s1 * s1 + s2 * s2 - coefficient * s1 * s2;
+            }
+
+            for (float x : frame)
+                total += x * x;
+        }
+
+        const double below = 10.0 * std::log10(power[1] / power[0]);
+        const double above = 10.0 * std::log10(power[1] / power[2]);
+        const double rms = std::sqrt(total / (200.0 * frameSize));
+        std::cout << "   Band-pass noise at " << rate << " Hz: 500 Hz " << below << " dB down, 2 kHz "
+                  << above << " dB down, RMS " << rms << "\n";
+        bandInPlace = bandInPlace && std::abs(below - 15.7) < 2.0 && std::abs(above - 15.7) < 2.0 && std::abs(rms - 1.0 / 3.0) < 0.06;
+    }
+
+    if (! bandInPlace)
+    {
+        std::cout << "❌ Band-pass noise moves with the sample rate\n";
+        return false;
+    }
+
+    // Shared tables: block and per-sample reads agree, and two voices with
+    // different seeds read uncorrelated noise from the same table
+    bool tablesMatch = true;
+    double correlation = 0.0, energy = 0.0;
+    for (auto type : { NoiseGenerator::White, NoiseGenerator::Pink, NoiseGenerator::Brown, NoiseGenerator::CustomMix })
+    {
+        NoiseGenerator perSample, perBlock, otherVoice;
+        for (auto* g : { &perSample, &perBlock, &otherVoice })
+        {
+            g->setNoiseType(type);
+            g->setUseSharedTables(true);
+        }
+        otherVoice.setSeed(7);
+
+        std::vector<float> rendered(4096), other(4096);
+        perBlock.processBlock(rendered.data(), 4000);
+        perBlock.processBlock(rendered.data() + 4000, 96);
+        otherVoice.processBlock(other.data(), 4096);
+
+        for (size_t i = 0; i < rendered.size(); ++i)
+        {
+            tablesMatch = tablesMatch && std::abs(rendered[i] - perSample.process()) < 1e-6f;
+
+            if (type == NoiseGenerator::White)
+            {
+                correlation += rendered[i] * other[i];
+                energy += rendered[i] * rendered[i];
+            }
+        }
+    }
+
+    const double normalisedCorrelation = correlation / energy;
+    std::cout << "   Shared tables match per-sample: " << (tablesMatch ? "yes" : "NO")
+              << ", correlation between voices: " << normalisedCorrelation << "\n";
+
+    if (! tablesMatch || std::abs(normalisedCorrelation) > 0.1)
+    {
+        std::cout << "❌ Shared noise tables are inconsistent or correlated between voices\n";
+        return false;
+    }
+
     return true;
 }
 
@@ -78,11 +385,174 @@ bool testOscillatorBank()
     sample = osc.process();
     std::cout << "   Wavetable sample: " << sample << "\n";
 
+    // At 9 kHz only the first two harmonics fit below Nyquist; the upper
+    // two must be dropped rather than folding back as aliases
+    {
+        OscillatorBank wt;
+        wt.prepare(48000.0);
+        wt.setFrequency(9000.0f);
+        wt.setOscillatorType(OscillatorBank::Wavetable);
+
+        float maxError = 0.0f;
+        for (int i = 0; i < 4800; ++i)
+        {
+            float t = 2.0f * juce::MathConstants<float>::pi * std::fmod(9000.0f * static_cast<float>(i) / 48000.0f, 1.0f);
+            float expected = (std::sin(t) + 0.5f * std::sin(2.0f * t)) / 1.875f;
+            maxError = std::max(maxError, std::abs(wt.process() - expected));
+        }
+
+        std::cout << "   Wavetable error vs band-limited reference at 9 kHz: " << maxError << "\n";
+        if (maxError > 1.0e-3f)
+        {
+            std::cout << "❌ Wavetable mip level not band-limited\n";
+            return false;
+        }
+    }
+
+    // A saw at 0.13 fs has its 5th harmonic fold back to 0.35 fs; the
+    // band-limited kernels must keep that alias well below the naive saw's
+    auto aliasLevel = [] (const std::vector<float>& signal)
+    {
+        double re = 0.0, im = 0.0;
+        for (size_t i = 2048; i < signal.size(); ++i)
+        {
+            re += signal[i] * std::cos(2.0 * juce::MathConstants<double>::pi * 0.35 * static_cast<double> (i));
+            im += signal[i] * std::sin(2.0 * juce::MathConstants<double>::pi * 0.35 * static_cast<double> (i));
+        }
+
+        return 20.0 * std::log10(2.0 * std::sqrt(re * re + im * im) / 2048.0 + 1.0e-12);
+    };
+
+    auto render = [] (OscillatorBank::OscillatorType type, int dpwOrder, OscillatorBank::PolyBLEPWaveform waveform)
+    {
+        OscillatorBank o;
+        o.prepare(48000.0);
+        o.setFrequency(0.13f * 48000.0f);
+        o.setOscillatorType(type);
+        o.setDPWOrder(dpwOrder);
+        o.setPolyBLEPWaveform(waveform);
+        o.reset();
+
+        std::vector<float> signal(4096);
+        o.processBlock(signal.data(), static_cast<int> (signal.size()));
+        return signal;
+    };
+
+    std::vector<float> naive(4096);
+    float naivePhase = 0.0f;
+    for (auto& sampleValue : naive)
+    {
+        sampleValue = 2.0f * naivePhase - 1.0f;
+        naivePhase += 0.13f;
+        if (naivePhase >= 1.0f) naivePhase -= 1.0f;
+    }
+
+    const auto saw = OscillatorBank::PolyBLEPWaveform::Saw;
+    const double aliasNaive = aliasLevel(naive);
+    const double aliasDPW2 = aliasLevel(render(OscillatorBank::DPW, 2, saw));
+    const double aliasDPW3 = aliasLevel(render(OscillatorBank::DPW, 3, saw));
+    const double aliasBLEP = aliasLevel(render(OscillatorBank::PolyBLEP, 2, saw));
+    std::cout << "   Saw alias at 0.35 fs: naive " << aliasNaive << " dB, DPW2 " << aliasDPW2
+              << " dB, DPW3 " << aliasDPW3 << " dB, PolyBLEP " << aliasBLEP << " dB\n";
+
+    // Block and per-sample rendering share one kernel and must agree; a block
+    // sums its phase a register at a time, so the phases round a little differently
+    OscillatorBank perSample, perBlock;
+    for (auto* o : { &perSample, &perBlock })
+    {
+        o->setFrequency(1234.0f);
+        o->setDPWOrder(3);
+        o->reset();
+    }
+
+    std::vector<float> block(256);
+    perBlock.processBlock(block.data(), 256);
+    bool blockMatches = true;
+    for (float expected : block)
+        blockMatches = blockMatches && std::abs(perSample.process() - expected) < 1.0e-4f;
+
+    if (aliasDPW2 > aliasNaive - 6.0 || aliasDPW3 > aliasDPW2 - 3.0 || aliasBLEP > aliasNaive - 10.0 || ! blockMatches)
+    {
+        std::cout << "❌ DPW/PolyBLEP kernels not band-limited or block output differs\n";
+        return false;
+    }
+
+    // Audio-rate pitch: a buffer holding the fixed increment must reproduce the
+    // fixed-pitch output, and a one-second sweep from 110 to 220 Hz must play
+    // the 165 cycles it integrates to
+    bool modulatedMatches = true;
+    for (auto type : { OscillatorBank::DPW, OscillatorBank::PolyBLEP, OscillatorBank::Wavetable, OscillatorBank::Detuned })
+    {
+        OscillatorBank fixed, modulated;
+        for (auto* o : { &fixed, &modulated })
+        {
+            o->prepare(48000.0);
+            o->setOscillatorType(type);
+            o->setFrequency(220.0f);
+            o->setDetune(20.0f);
+            o->reset();
+        }
+
+        std::vector<float> expected(512), actual(512), increments(512, 220.0f / 48000.0f);
+        fixed.processBlock(expected.data(), 512);
+        modulated.processBlock(actual.data(), increments.data(), 512);
+
+        for (size_t i = 0; i < expected.size(); ++i)
+            modulatedMatches = modulatedMatches && std::abs(expected[i] - actual[i]) < 1.0e-5f;
+    }
+
+    OscillatorBank sweep;
+    sweep.prepare(48000.0);
+    sweep.setOscillatorType(OscillatorBank::PolyBLEP);
+    sweep.reset();
+
+    std::vector<float> sweepIncrements(48000), sweepOutput(48000);
+    for (size_t i = 0; i < sweepIncrements.size(); ++i)
+        sweepIncrements[i] = (110.0f + 110.0f * static_cast<float> (i) / 48000.0f) / 48000.0f;
+
+    sweep.processBlock(sweepOutput.data(), sweepIncrements.data(), 48000);
+
+    int cycles = 0;
+    for (size_t i = 1; i < sweepOutput.size(); ++i)
+        if (sweepOutput[i - 1] < 0.0f && sweepOutput[i] >= 0.0f)
+            ++cycles;
+
+    std::cout << "   Modulated block matches fixed pitch: " << (modulatedMatches ? "yes" : "NO")
+              << ", cycles in 110-220 Hz sweep: " << cycles << "\n";
+    if (! modulatedMatches || std::abs(cycles - 165) > 1)
+    {
+        std::cout << "❌ Audio-rate pitch modulation wrong\n";
+        return false;
+    }
+
     osc.setOscillatorType(OscillatorBank::Detuned);
     osc.setDetune(10.0f);
     sample = osc.process();
     std::cout << "   Detuned sample: " << sample << "\n";
 
+    // A 16-voice unison stack stays within range and actually beats:
+    // with the voices drifting apart the output level changes over time
+    osc.prepare(48000.0);
+    osc.setFrequency(110.0f);
+    osc.setNumVoices(OscillatorBank::maxUnisonVoices);
+    osc.setDetune(50.0f);
+    osc.reset();
+
+    float peak = 0.0f, firstHalf = 0.0f, secondHalf = 0.0f;
+    for (int i = 0; i < 48000; ++i)
+    {
+        float s = osc.process();
+        peak = std::max(peak, std::abs(s));
+        (i < 24000 ? firstHalf : secondHalf) += s * s;
+    }
+
+    std::cout << "   16-voice unison peak: " << peak << "\n";
+    if (peak > 1.0001f || firstHalf <= 0.0f || std::abs(firstHalf - secondHalf) < 1.0e-3f * firstHalf)
+    {
+        std::cout << "❌ Unison output out of range or not detuned\n";
+        return false;
+    }
+
     return true;
 }
 
@@ -90,7 +560,7 @@ bool testResonanceSystem()
 {
     std::cout << "\n✅ Testing ResonanceSystem...\n";
 
-    ResonanceSystem resonance;
+    ResonanceSystem<float> resonance;
     resonance.setChestResonance(0.6f);
     resonance.setThroatConstriction(0.4f);
 
@@ -104,6 +574,148 @@ bool testResonanceSystem()
     output = resonance.process(input);
     std::cout << "   Modified formant output: " << output << "\n";
 
+    // Steady-state gain of a sine through a resonance with every formant at 1 kHz, Q 8
+    const auto sineGain = [] (ResonanceSystem<float>& r, double rate, double frequency, int numSamples)
+    {
+        double peak = 0.0;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float y = r.process(static_cast<float> (std::sin(2.0 * M_PI * frequency * i / rate)));
+            if (i >= numSamples / 2)
+                peak = std::max(peak, static_cast<double> (std::abs(y)));
+        }
+        return peak;
+    };
+
+    const auto formantsAt = [] (ResonanceSystem<float>& r, float frequency)
+    {
+        for (int i = 0; i < 5; ++i)
+        {
+            r.setFormantFrequency(i, frequency);
+            r.setFormantQ(i, 8.0f);
+        }
+    };
+
+    // prepare(): the formants sit at the same Hz at 48 and 96 kHz
+    bool rateIndependent = true;
+    double gains[2][2] = {};
+    for (int r = 0; r < 2; ++r)
+    {
+        const double rate = r == 0 ? 48000.0 : 96000.0;
+        for (int f = 0; f < 2; ++f)
+        {
+            ResonanceSystem<float> formants;
+            formantsAt(formants, 1000.0f);
+            formants.prepare(rate);
+            gains[r][f] = sineGain(formants, rate, f == 0 ? 1000.0 : 2000.0, static_cast<int> (rate / 5.0));
+        }
+    }
+
+    const double peakToOctave48 = 20.0 * std::log10(gains[0][0] / gains[0][1]);
+    const double peakToOctave96 = 20.0 * std::log10(gains[1][0] / gains[1][1]);
+    rateIndependent = peakToOctave48 > 15.0 && std::abs(peakToOctave48 - peakToOctave96) < 0.5;
+    std::cout << "   1 kHz formants, 1 kHz vs 2 kHz: " << peakToOctave48 << " dB at 48 kHz, "
+              << peakToOctave96 << " dB at 96 kHz\n";
+
+    // Smoothing: a formant jump glides in over ~20 ms, block and per-sample agree,
+    // and after the glide the filter matches one prepared at the new setting
+    ResonanceSystem<float> perSample, perBlock, settled;
+    for (auto* r : { &perSample, &perBlock })
+    {
+        formantsAt(*r, 500.0f);
+        r->prepare(48000.0);
+    }
+    formantsAt(settled, 1000.0f);
+    settled.prepare(48000.0);
+
+    std::vector<float> sine(24000), blockOut(24000);
+    for (size_t i = 0; i < sine.size(); ++i)
+        sine[i] = static_cast<float> (std::sin(2.0 * M_PI * 1000.0 * static_cast<double> (i) / 48000.0));
+
+    formantsAt(perSample, 1000.0f);
+    formantsAt(perBlock, 1000.0f);
+    for (int start = 0; start < 24000; start += 100)
+        perBlock.processBlock(blockOut.data() + start, sine.data() + start, 100);
+
+    bool smoothMatches = true;
+    double earlyPeak = 0.0, latePeak = 0.0, settledPeak = 0.0;
+    for (size_t i = 0; i < sine.size(); ++i)
+    {
+        const float y = perSample.process(sine[i]);
+        const float reference = settled.process(sine[i]);
+        smoothMatches = smoothMatches && std::abs(y - blockOut[i]) < 1.0e-6f;
+
+        if (i < 240)          earlyPeak = std::max(earlyPeak, static_cast<double> (std::abs(y)));
+        else if (i >= 12000)
+        {
+            latePeak = std::max(latePeak, static_cast<double> (std::abs(y)));
+            settledPeak = std::max(settledPeak, static_cast<double> (std::abs(reference)));
+        }
+    }
+
+    std::cout << "   Formant glide: block matches per-sample: " << (smoothMatches ? "yes" : "NO")
+              << ", first 5 ms peak " << earlyPeak << ", settled " << latePeak << " (reference " << settledPeak << ")\n";
+
+    // The float bank keeps its formants in lanes, the voice-lane bank keeps voices in lanes; both compute the same filter
+    ResonanceSystem<VoiceLanes> laneBank;
+    ResonanceSystem<float> floatBank;
+    for (int i = 0; i < 5; ++i)
+    {
+        laneBank.setFormantFrequency(i, 300.0f + 700.0f * i);
+        floatBank.setFormantFrequency(i, 300.0f + 700.0f * i);
+    }
+    laneBank.prepare(48000.0);
+    floatBank.prepare(48000.0);
+
+    double laneError = 0.0;
+    for (size_t i = 0; i < 4800; ++i)
+    {
+        const float y = Lanes<VoiceLanes>::get(laneBank.process(VoiceLanes(sine[i])), 0);
+        laneError = std::max(laneError, static_cast<double> (std::abs(y - floatBank.process(sine[i]))));
+    }
+    std::cout << "   Voice-lane bank vs formant-lane bank: max difference " << laneError << "\n";
+
+    // The SVF engine has the biquads' response, and follows audio-rate modulation without blowing up
+    ResonanceSystem<float> svf;
+    svf.setEngine(FormantEngine::StateVariable);
+    formantsAt(svf, 1000.0f);
+    svf.prepare(48000.0);
+    const double svfGain = sineGain(svf, 48000.0, 1000.0, 9600);
+    svf.reset();
+    const double svfOctave = 20.0 * std::log10(svfGain / sineGain(svf, 48000.0, 2000.0, 9600));
+
+    std::vector<float> unmodulated(4800), modulated(4800), multipliers(4800, 1.0f);
+    svf.reset();
+    svf.processBlock(unmodulated.data(), sine.data(), 4800);
+    svf.reset();
+    svf.processBlock(modulated.data(), sine.data(), multipliers.data(), 4800);
+
+    double modulationError = 0.0;
+    for (size_t i = 0; i < modulated.size(); ++i)
+        modulationError = std::max(modulationError, static_cast<double> (std::abs(modulated[i] - unmodulated[i])));
+
+    // A four-octave wah at 200 Hz, reaching past Nyquist at the top
+    for (size_t i = 0; i < multipliers.size(); ++i)
+        multipliers[i] = static_cast<float> (std::exp2(3.0 + 2.0 * std::sin(2.0 * M_PI * 200.0 * static_cast<double> (i) / 48000.0)));
+
+    svf.processBlock(modulated.data(), sine.data(), multipliers.data(), 4800);
+    double sweepPeak = 0.0;
+    for (float y : modulated)
+        sweepPeak = std::max(sweepPeak, std::isfinite(y) ? static_cast<double> (std::abs(y)) : 1.0e9);
+
+    std::cout << "   SVF engine: 1 kHz gain " << svfGain << " (biquad " << gains[0][0] << "), 1 kHz vs 2 kHz "
+              << svfOctave << " dB, x1 modulation error " << modulationError << ", wah sweep peak " << sweepPeak << "\n";
+
+    const bool svfMatches = std::abs(20.0 * std::log10(svfGain / gains[0][0])) < 0.05
+                            && std::abs(svfOctave - peakToOctave48) < 0.1
+                            && modulationError < 1.0e-5 && sweepPeak < 10.0;
+
+    if (! rateIndependent || ! smoothMatches || laneError > 1.0e-4 || ! svfMatches || earlyPeak > 0.5 * settledPeak || std::abs(latePeak - settledPeak) > 0.01 * settledPeak)
+    {
+        std::cout << "❌ Formants depend on the sample rate or do not glide smoothly\n";
+        return false;
+    }
+
     return true;
 }
 
@@ -111,8 +723,8 @@ bool testDistortionStage()
 {
     std::cout << "\n✅ Testing DistortionStage...\n";
 
-    DistortionStage distortion;
-    distortion.setDistortionType(DistortionStage::SoftClip);
+    DistortionStage<float> distortion;
+    distortion.setDistortionType(DistortionStage<float>::SoftClip);
     distortion.setDrive(2.0f);
 
     // Process a sine wave
@@ -121,19 +733,74 @@ bool testDistortionStage()
     std::cout << "   Soft clip output: " << output << "\n";
 
     // Test all distortion types
-    distortion.setDistortionType(DistortionStage::HardClip);
+    distortion.setDistortionType(DistortionStage<float>::HardClip);
     output = distortion.process(input);
     std::cout << "   Hard clip output: " << output << "\n";
 
-    distortion.setDistortionType(DistortionStage::Waveshape);
+    distortion.setDistortionType(DistortionStage<float>::Waveshape);
     output = distortion.process(input);
     std::cout << "   Waveshape output: " << output << "\n";
 
-    distortion.setDistortionType(DistortionStage::Chebyshev);
+    distortion.setDistortionType(DistortionStage<float>::Chebyshev);
     output = distortion.process(input);
     std::cout << "   Chebyshev output: " << output << "\n";
 
-    return true;
+    // Block processing must match sample-by-sample processing for every type
+    float ramp[64], block[64];
+    for (int i = 0; i < 64; ++i)
+        ramp[i] = static_cast<float> (i - 32) / 32.0f;
+
+    bool blockMatches = true;
+    for (int type = DistortionStage<float>::SoftClip; type <= DistortionStage<float>::HarmonicBalancer; ++type)
+    {
+        distortion.setDistortionType(static_cast<DistortionStage<float>::DistortionType> (type));
+        distortion.processBlock(block, ramp, 64);
+
+        for (int i = 0; i < 64; ++i)
+            blockMatches = blockMatches && std::abs(block[i] - distortion.process(ramp[i])) < 1.0e-6f;
+    }
+
+    std::cout << "   Block processing matches per-sample: " << (blockMatches ? "yes" : "NO") << "\n";
+
+    // Oversampling: the 3rd harmonic of a hard-clipped tone at 0.37 fs folds back
+    // to 0.11 fs at the base rate; 4x oversampling must push that alias down
+    auto aliasLevel = [] (int factorLog2, OversamplingFilter filter)
+    {
+        DistortionStage<float> clipper;
+        clipper.setDistortionType(DistortionStage<float>::HardClip);
+        clipper.setDrive(10.0f);
+        clipper.setWarmth(0.0f);
+        clipper.setAggression(0.0f);
+        clipper.setOversampling(factorLog2, filter);
+
+        std::vector<float> signal(4096);
+        for (size_t i = 0; i < signal.size(); ++i)
+            signal[i] = 0.5f * std::sin(2.0f * juce::MathConstants<float>::pi * 0.37f * static_cast<float> (i));
+
+        clipper.processBlock(signal.data(), signal.data(), static_cast<int> (signal.size()));
+
+        double re = 0.0, im = 0.0;
+        for (size_t i = 2048; i < signal.size(); ++i)
+        {
+            re += signal[i] * std::cos(2.0 * juce::MathConstants<double>::pi * 0.11 * static_cast<double> (i));
+            im += signal[i] * std::sin(2.0 * juce::MathConstants<double>::pi * 0.11 * static_cast<double> (i));
+        }
+
+        return 20.0 * std::log10(2.0 * std::sqrt(re * re + im * im) / 2048.0 + 1.0e-12);
+    };
+
+    const double aliasPlain = aliasLevel(0, OversamplingFilter::MinimumPhase);
+    const double aliasLinear = aliasLevel(2, OversamplingFilter::LinearPhase);
+    const double aliasMinimum = aliasLevel(2, OversamplingFilter::MinimumPhase);
+    std::cout << "   Alias at 0.11 fs: 1x " << aliasPlain << " dB, 4x linear " << aliasLinear
+              << " dB, 4x minimum " << aliasMinimum << " dB\n";
+
+    DistortionStage<float> oversampled;
+    oversampled.setOversampling(2, OversamplingFilter::LinearPhase);
+    std::cout << "   4x linear-phase latency: " << oversampled.getLatencyInSamples() << " samples\n";
+
+    return blockMatches && aliasLinear < aliasPlain - 20.0 && aliasMinimum < aliasPlain - 20.0
+        && oversampled.getLatencyInSamples() > 0.0;
 }
 
 bool testSizeScaler()
@@ -159,6 +826,123 @@ bool testSizeScaler()
     return true;
 }
 
+bool testFormantSizeTable()
+{
+    std::cout << "\n✅ Testing FormantSizeTable...\n";
+
+    const float freqs[maxFormants] = {180.0f, 520.0f, 900.0f, 1700.0f, 2900.0f, 3800.0f, 4700.0f, 5600.0f};
+    const float qs[maxFormants] = {9.0f, 7.0f, 6.0f, 5.0f, 4.0f, 4.0f, 4.0f, 4.0f};
+    FormantSizeTable table;
+    table.build(freqs, qs, 48000.0, SizeScaler::Allometric);
+
+    RandomLanes random;
+    std::vector<float> input(4800);
+    for (auto& x : input)
+        x = random.next();
+
+    // A size between table rows, one on the reference size and a large one:
+    // the table-driven bank matches formants scaled and computed directly
+    double worstError = 0.0;
+    for (float size : {3.7f, 10.0f, 250.0f})
+    {
+        SizeScaler scaler;
+        scaler.setScalingType(SizeScaler::Allometric);
+        scaler.setSizeFeet(size);
+
+        ResonanceSystem<float> direct, fromTable;
+        for (int i = 0; i < 5; ++i)
+        {
+            direct.setFormantFrequency(i, freqs[i] * scaler.getFormantMultiplier());
+            direct.setFormantQ(i, qs[i]);
+        }
+        direct.prepare(48000.0);
+        fromTable.setLaneSize(0, size);
+        fromTable.prepare(48000.0);
+        fromTable.setSizeTable(&table);
+
+        double error = 0.0, peak = 0.0;
+        for (float x : input)
+        {
+            const float reference = direct.process(x);
+            error = std::max(error, static_cast<double> (std::abs(fromTable.process(x) - reference)));
+            peak = std::max(peak, static_cast<double> (std::abs(reference)));
+        }
+        worstError = std::max(worstError, error / peak);
+    }
+
+    // Every voice lane follows its own size
+    const float laneSizes[4] = {2.0f, 10.0f, 60.0f, 900.0f};
+    ResonanceSystem<VoiceLanes> lanes;
+    ResonanceSystem<float> single[4];
+    lanes.setSizeTable(&table);
+    for (size_t lane = 0; lane < Lanes<VoiceLanes>::size; ++lane)
+    {
+        lanes.setLaneSize(lane, laneSizes[lane % 4]);
+        lanes.resetLane(lane);
+        single[lane % 4].setSizeTable(&table);
+        single[lane % 4].setLaneSize(0, laneSizes[lane % 4]);
+        single[lane % 4].resetLane(0);
+    }
+
+    double laneError = 0.0;
+    for (float x : input)
+    {
+        const VoiceLanes y = lanes.process(VoiceLanes(x));
+        for (size_t lane = 0; lane < std::min<size_t>(4, Lanes<VoiceLanes>::size); ++lane)
+            laneError = std::max(laneError, static_cast<double> (std::abs(Lanes<VoiceLanes>::get(y, lane) - single[lane].process(x))));
+    }
+
+    // Eight formants on the same centre have the gain of five: the bank's
+    // level is normalised by the count
+    ResonanceSystem<float, 8> eight;
+    ResonanceSystem<float> five;
+    for (int i = 0; i < 8; ++i)
+    {
+        eight.setFormantFrequency(i, 1000.0f);
+        five.setFormantFrequency(i, 1000.0f);
+    }
+    eight.prepare(48000.0);
+    five.prepare(48000.0);
+
+    double eightEnergy = 0.0, fiveEnergy = 0.0;
+    for (int i = 0; i < 4800; ++i)
+    {
+        const float x = std::sin(2.0f * 3.14159265f * 1000.0f * static_cast<float> (i) / 48000.0f);
+        const float a = eight.process(x);
+        const float b = five.process(x);
+        if (i >= 2400)
+        {
+            eightEnergy += a * a;
+            fiveEnergy += b * b;
+        }
+    }
+    const double countGainDb = 10.0 * std::log10(eightEnergy / fiveEnergy);
+
+    // A run-time count runs the specialisation it picked
+    ResonanceSystemVariant<float> variable;
+    ResonanceSystem<float, 3> three;
+    variable.setNumFormants(3);
+    variable.setSizeTable(&table);
+    variable.setLaneSize(0, 40.0f);
+    variable.resetLane(0);
+    three.setSizeTable(&table);
+    three.setLaneSize(0, 40.0f);
+    three.resetLane(0);
+
+    double variantError = 0.0;
+    for (float x : input)
+        variantError = std::max(variantError, static_cast<double> (std::abs(variable.process(x) - three.process(x))));
+
+    std::cout << "   Table vs direct formants: worst error " << worstError * 100.0 << "% of peak\n";
+    std::cout << "   Per-lane sizes vs single voices: max difference " << laneError << "\n";
+    std::cout << "   8 vs 5 formants at one centre: " << countGainDb << " dB\n";
+    std::cout << "   " << variable.getNumFormants() << "-formant variant vs ResonanceSystem<float, 3>: max difference " << variantError << "\n";
+
+    return worstError < 0.01 && laneError < 1.0e-4
+        && std::abs(countGainDb) < 0.1
+        && variable.getNumFormants() == 3 && variantError == 0.0;
+}
+
 bool testModulationSystem()
 {
     std::cout << "\n✅ Testing ModulationSystem...\n";
@@ -203,7 +987,174 @@ bool testGrowlProcessor()
     // Note off
     processor.noteOff(60);
 
-    return true;
+    // A released voice must go to sleep once its tail has died away, at any sample rate
+    GrowlProcessor sleeper;
+    sleeper.prepare(96000.0, 512);
+    sleeper.noteOn(60, 0.8f);
+    sleeper.processBlock(buffer, 512);
+    sleeper.noteOff(60);
+
+    int blocksUntilSleep = 0;
+    while (sleeper.getNumActiveVoices() > 0 && blocksUntilSleep < 96000 / 512)
+    {
+        sleeper.processBlock(buffer, 512);
+        ++blocksUntilSleep;
+    }
+
+    const bool voiceSlept = sleeper.getNumActiveVoices() == 0;
+    std::cout << "   Released voice asleep after " << blocksUntilSleep * 512 / 96.0f << " ms\n";
+
+    // Shapers that are biased at zero must not keep released voices awake or leave DC behind
+    bool shapedVoicesSlept = true;
+    float shapedTail = 0.0f;
+    for (auto type : {DistortionType::Chebyshev, DistortionType::HarmonicBalancer})
+    {
+        PresetParameters shaped;
+        shaped.distortionType = type;
+        GrowlProcessor biased;
+        biased.prepare(48000.0, 512);
+        biased.applyPreset(shaped);
+
+        for (int cycle = 0; cycle < 20; ++cycle)
+        {
+            biased.noteOn(40 + cycle, 0.8f);
+            for (int block = 0; block < 10; ++block)
+                biased.processBlock(buffer, 512);
+            biased.noteOff(40 + cycle);
+        }
+
+        for (int block = 0; block < 10 * 48000 / 512; ++block)
+            biased.processBlock(buffer, 512);
+
+        shapedVoicesSlept = shapedVoicesSlept && biased.getNumActiveVoices() == 0;
+        for (float x : buffer)
+            shapedTail = std::max(shapedTail, std::abs(x));
+    }
+
+    std::cout << "   Chebyshev / HarmonicBalancer voices asleep after 10 s: " << (shapedVoicesSlept ? "yes" : "NO")
+              << ", tail peak " << shapedTail << "\n";
+
+    // Retriggering a sounding voice must not click: it carries on from where
+    // it was, so the first samples follow a twin that is not retriggered
+    GrowlProcessor held, retriggered;
+    float heldBuffer[512];
+    for (auto* p : {&held, &retriggered})
+    {
+        p->prepare(48000.0, 512);
+        p->noteOn(48, 0.9f);
+    }
+
+    for (int block = 0; block < 40; ++block)
+    {
+        held.processBlock(heldBuffer, 512);
+        retriggered.processBlock(buffer, 512);
+    }
+
+    retriggered.noteOn(48, 0.9f);
+    held.processBlock(heldBuffer, 512);
+    retriggered.processBlock(buffer, 512);
+
+    float retriggerJump = 0.0f, heldPeak = 0.0f;
+    for (int i = 0; i < 512; ++i)
+    {
+        if (i < 16)
+            retriggerJump = std::max(retriggerJump, std::abs(buffer[i] - heldBuffer[i]));
+        heldPeak = std::max(heldPeak, std::abs(heldBuffer[i]));
+    }
+
+    std::cout << "   Retrigger departs from the held note by " << retriggerJump / heldPeak * 100.0f << "% of peak\n";
+
+    // Two preset changes before the audio thread picks up a size table: the
+    // first table is taken back, and rendering uses the second preset's, also
+    // when the second is applied in the plugin's two steps
+    PresetParameters small, large;
+    small.sizeFeet = 2.0f;
+    large.sizeFeet = 400.0f;
+    large.formantFreqs[0] = 150.0f;
+    large.numFormants = 8;
+    GrowlProcessor quickChanges, direct;
+    float directBuffer[512];
+    quickChanges.prepare(48000.0, 512);
+    direct.prepare(48000.0, 512);
+    quickChanges.applyPreset(large);
+    quickChanges.applyPreset(small);
+    quickChanges.publishPresetFormants(large);
+    quickChanges.applyPresetToVoices(large);
+    direct.applyPreset(large);
+    quickChanges.noteOn(50, 0.8f);
+    direct.noteOn(50, 0.8f);
+
+    bool latestTableUsed = true;
+    for (int block = 0; block < 4; ++block)
+    {
+        quickChanges.processBlock(buffer, 512);
+        direct.processBlock(directBuffer, 512);
+        latestTableUsed = latestTableUsed && std::memcmp(buffer, directBuffer, sizeof (buffer)) == 0;
+    }
+
+    std::cout << "   Quick preset changes render the latest size table: " << (latestTableUsed ? "yes" : "NO")
+              << ", " << quickChanges.getNumFormants() << " formants\n";
+
+    // Sample-accurate MIDI: a note-on at sample 100 must stay silent before it
+    GrowlProcessor accurate;
+    accurate.prepare(48000.0, 512);
+
+    juce::MidiBuffer midi;
+    midi.addEvent(juce::MidiMessage::noteOn(1, 60, 0.8f), 100);
+    accurate.processBlock(buffer, 512, midi);
+
+    bool silentBeforeEvent = true;
+    for (int i = 0; i < 100; ++i)
+        silentBeforeEvent = silentBeforeEvent && buffer[i] == 0.0f;
+
+    std::cout << "   Note-on at sample 100, first sounding sample: " << buffer[100] << "\n";
+
+    // Burst of more notes than voices: every note must still get a voice
+    for (int note = 0; note < GrowlProcessor::maxVoices + 16; ++note)
+        accurate.noteOn(note, 0.5f);
+    accurate.processBlock(buffer, 512);
+
+    const bool burstHandled = accurate.getNumActiveVoices() == GrowlProcessor::maxVoices;
+    std::cout << "   Active voices after " << GrowlProcessor::maxVoices + 16 << "-note burst: "
+              << accurate.getNumActiveVoices() << "\n";
+
+    // Multi-threaded rendering must match single-threaded rendering bit for bit
+    GrowlProcessor singleThreaded, multiThreaded;
+    multiThreaded.setNumRenderThreads(4);
+    singleThreaded.prepare(48000.0, 512);
+    multiThreaded.prepare(48000.0, 512);
+
+    float singleBuffer[512], multiBuffer[512];
+    bool deterministic = true;
+
+    for (int note = 36; note < 36 + 96; ++note)
+    {
+        singleThreaded.noteOn(note, 0.7f);
+        multiThreaded.noteOn(note, 0.7f);
+    }
+
+    for (int block = 0; block < 20; ++block)
+    {
+        singleThreaded.processBlock(singleBuffer, 512);
+        multiThreaded.processBlock(multiBuffer, 512);
+        deterministic = deterministic && std::memcmp(singleBuffer, multiBuffer, sizeof (singleBuffer)) == 0;
+    }
+
+    std::cout << "   4-thread render matches 1-thread render: " << (deterministic ? "yes" : "NO") << "\n";
+
+    // Voice pool memory layout
+    constexpr auto footprint = GrowlProcessor::getVoiceFootprint();
+    std::cout << "   Voice footprint (" << footprint.numVoices << " voices):\n";
+    std::cout << "     info " << footprint.voiceInfo << " B, noise " << footprint.noise
+              << " B, osc " << footprint.oscillator << " B, formant " << footprint.resonance
+              << " B, dist " << footprint.distortion << " B, env " << footprint.envelope << " B\n";
+    std::cout << "     per voice " << footprint.perVoice << " B, pool " << footprint.poolTotal << " B\n";
+
+    return silentBeforeEvent && buffer[100] != 0.0f && burstHandled && deterministic && voiceSlept
+        && shapedVoicesSlept && shapedTail == 0.0f
+        && retriggerJump < 0.05f * heldPeak
+        && latestTableUsed && quickChanges.getNumFormants() == 8
+        && footprint.poolTotal >= footprint.perVoice * static_cast<size_t> (footprint.numVoices);
 }
 
 int main()
@@ -213,13 +1164,15 @@ int main()
     std::cout << "\nTesting all DSP modules...\n";
 
     int passed = 0;
-    int total = 7;
+    int total = 9;
 
+    if (testFastMath()) passed++;
     if (testNoiseGenerator()) passed++;
     if (testOscillatorBank()) passed++;
     if (testResonanceSystem()) passed++;
     if (testDistortionStage()) passed++;
     if (testSizeScaler()) passed++;
+    if (testFormantSizeTable()) passed++;
     if (testModulationSystem()) passed++;
     if (testGrowlProcessor()) passed++;
 
@@ -0,0 +1,587 @@
+/*
+  ==============================================================================
+
+    GrowlBench.cpp
+    Created: 17 Oct 2026 5:00:00pm
+    Author:  White Room Audio
+
+    Microbenchmarks for every DSP module and the full polyphonic engine.
+    Sweeps block sizes and sample rates and reports ns/sample and real-time
+    factor as CSV or JSON, so runs from different builds can be compared
+    (--compare prints the per-case speedup against an earlier CSV).
+
+  ==============================================================================
+*/
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "dsp/GrowlDSP.h"
+#include "dsp/FactoryPresets.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Growl::DSP;
+
+namespace
+{
+
+//==============================================================================
+struct BenchSettings
+{
+    std::vector<int> blockSizes { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+    std::vector<double> sampleRates { 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+    double secondsPerCase = 0.5;        // audio rendered per repetition
+    int repetitions = 3;                // best of
+    std::string filter;                 // only run modules whose name contains this
+    std::string label = "growl";
+    bool json = false;
+    std::string outputPath;
+    std::string comparePath;
+};
+
+struct BenchResult
+{
+    std::string module, variant;
+    int voices = 1;
+    double sampleRate = 0.0;
+    int blockSize = 0;
+    double nsPerSample = 0.0;           // per output sample of the whole unit
+    double realTimeFactor = 0.0;        // processing time / audio time, below 1 is faster than real time
+
+    std::string key() const
+    {
+        std::ostringstream s;
+        s << module << '/' << variant << '/' << voices << '/' << sampleRate << '/' << blockSize;
+        return s.str();
+    }
+};
+
+volatile float sink = 0.0f;
+
+/**
+    Runs process (buffer, numSamples) over secondsPerCase of audio, a few
+    times, and keeps the fastest repetition.
+*/
+template <typename Process>
+BenchResult measure (const BenchSettings& settings, double sampleRate, int blockSize, Process&& process)
+{
+    std::vector<float> buffer (static_cast<size_t> (blockSize));
+    const auto numBlocks = juce::jmax (1, static_cast<int> (settings.secondsPerCase * sampleRate / blockSize));
+
+    // Warm caches and branch predictors
+    for (int b = 0; b < juce::jmax (1, numBlocks / 10); ++b)
+        process (buffer.data(), blockSize);
+
+    double best = 1.0e30;
+
+    for (int rep = 0; rep < settings.repetitions; ++rep)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int b = 0; b < numBlocks; ++b)
+        {
+            process (buffer.data(), blockSize);
+            sink = sink + buffer[0];
+        }
+
+        best = std::min (best, std::chrono::duration<double> (std::chrono::steady_clock::now() - start).count());
+    }
+
+    const double numSamples = static_cast<double> (numBlocks) * blockSize;
+
+    BenchResult result;
+    result.sampleRate = sampleRate;
+    result.blockSize = blockSize;
+    result.nsPerSample = best * 1.0e9 / numSamples;
+    result.realTimeFactor = best / (numSamples / sampleRate);
+    return result;
+}
+
+/** Fills a buffer with a loud, harmonically rich test signal for the filters and shapers. */
+void fillTestSignal (float* buffer, int numSamples, double sampleRate)
+{
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto t = static_cast<float> (i / sampleRate);
+        buffer[i] = 0.6f * std::sin (juce::MathConstants<float>::twoPi * 110.0f * t)
+                  + 0.3f * std::sin (juce::MathConstants<float>::twoPi * 1730.0f * t);
+    }
+}
+
+//==============================================================================
+class Bench
+{
+public:
+    explicit Bench (const BenchSettings& s) : settings (s) {}
+
+    void runAll()
+    {
+        static const std::pair<NoiseGenerator::NoiseType, const char*> noiseTypes[] = {
+            { NoiseGenerator::White, "White" }, { NoiseGenerator::Pink, "Pink" }, { NoiseGenerator::Brown, "Brown" },
+            { NoiseGenerator::Bandpass, "Bandpass" }, { NoiseGenerator::PinkMixed, "PinkMixed" }, { NoiseGenerator::CustomMix, "CustomMix" } };
+
+        static const std::pair<OscillatorBank::OscillatorType, const char*> oscillatorTypes[] = {
+            { OscillatorBank::DPW, "DPW" }, { OscillatorBank::PolyBLEP, "PolyBLEP" },
+            { OscillatorBank::Wavetable, "Wavetable" }, { OscillatorBank::Detuned, "Detuned" } };
+
+        using Distortion = DistortionStage<float>;
+        static const std::pair<Distortion::DistortionType, const char*> distortionTypes[] = {
+            { Distortion::SoftClip, "SoftClip" }, { Distortion::HardClip, "HardClip" }, { Distortion::Waveshape, "Waveshape" },
+            { Distortion::Chebyshev, "Chebyshev" }, { Distortion::Bitcrush, "Bitcrush" }, { Distortion::Wavefolder, "Wavefolder" },
+            { Distortion::HarmonicBalancer, "HarmonicBalancer" } };
+
+        for (const auto& [type, name] : noiseTypes)
+            sweep ("NoiseGenerator", name, 1, [type = type] (double sampleRate, int)
+            {
+                auto noise = std::make_shared<NoiseGenerator>();
+                noise->prepare (sampleRate);
+                noise->setNoiseType (type);
+                return [noise] (float* buffer, int n) { noise->processBlock (buffer, n); };
+            });
+
+        // Same noise read from the shared precomputed tables
+        for (const auto& [type, name] : noiseTypes)
+            sweep ("NoiseGenerator", std::string (name) + " Table", 1, [type = type] (double sampleRate, int)
+            {
+                auto noise = std::make_shared<NoiseGenerator>();
+                noise->prepare (sampleRate);
+                noise->setNoiseType (type);
+                noise->setUseSharedTables (true);
+                return [noise] (float* buffer, int n) { noise->processBlock (buffer, n); };
+            });
+
+        // Pink noise for a whole voice group, one voice per lane, as GrowlProcessor renders it
+        for (const auto& [type, name] : noiseTypes)
+            if (NoiseLanes<VoiceLanes>::supports (type))
+                sweep ("NoiseGenerator", std::string (name) + " voice lanes", NoiseLanes<VoiceLanes>::numLanes, [type = type] (double, int blockSize)
+                {
+                    auto noise = std::make_shared<NoiseLanes<VoiceLanes>>();
+                    noise->setNoiseType (type);
+                    auto output = std::make_shared<std::vector<VoiceLanes>> (static_cast<size_t> (blockSize));
+
+                    return [noise, output] (float* buffer, int n)
+                    {
+                        noise->processBlock (output->data(), n);
+                        buffer[0] = Lanes<VoiceLanes>::get ((*output)[0], 0);
+                    };
+                });
+
+        for (const auto& [type, name] : oscillatorTypes)
+            sweep ("OscillatorBank", name, 1, [type = type] (double sampleRate, int)
+            {
+                auto oscillator = std::make_shared<OscillatorBank>();
+                oscillator->prepare (sampleRate);
+                oscillator->setOscillatorType (type);
+                oscillator->setFrequency (110.0f);
+                oscillator->setDetune (10.0f);
+                return [oscillator] (float* buffer, int n) { oscillator->processBlock (buffer, n); };
+            });
+
+        // Same oscillators with an audio-rate vibrato (6 Hz, +/-50 cents) fed as per-sample increments
+        for (const auto& [type, name] : oscillatorTypes)
+            sweep ("OscillatorBank", std::string (name) + " FM", 1, [type = type] (double sampleRate, int blockSize)
+            {
+                auto oscillator = std::make_shared<OscillatorBank>();
+                oscillator->prepare (sampleRate);
+                oscillator->setOscillatorType (type);
+                oscillator->setDetune (10.0f);
+
+                auto increments = std::make_shared<std::vector<float>> (static_cast<size_t> (blockSize));
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    const auto vibrato = std::sin (juce::MathConstants<double>::twoPi * 6.0 * i / sampleRate) * 50.0 / 1200.0;
+                    (*increments)[static_cast<size_t> (i)] = static_cast<float> (110.0 * std::exp2 (vibrato) / sampleRate);
+                }
+
+                return [oscillator, increments] (float* buffer, int n) { oscillator->processBlock (buffer, increments->data(), n); };
+            });
+
+        sweep ("ResonanceSystem", "scalar", 1, [] (double sampleRate, int blockSize)
+        {
+            auto resonance = std::make_shared<ResonanceSystem<float>>();
+            resonance->prepare (sampleRate);
+            auto input = std::make_shared<std::vector<float>> (static_cast<size_t> (blockSize));
+            fillTestSignal (input->data(), blockSize, sampleRate);
+            return [resonance, input] (float* buffer, int n) { resonance->processBlock (buffer, input->data(), n); };
+        });
+
+        // Other formant counts, through the run-time dispatch the voice pool uses
+        for (int numFormants : { 3, 8 })
+            sweep ("ResonanceSystem", "scalar " + std::to_string (numFormants) + " formants", 1, [numFormants] (double sampleRate, int blockSize)
+            {
+                auto resonance = std::make_shared<ResonanceSystemVariant<float>>();
+                resonance->setNumFormants (numFormants);
+                resonance->prepare (sampleRate);
+                auto input = std::make_shared<std::vector<float>> (static_cast<size_t> (blockSize));
+                fillTestSignal (input->data(), blockSize, sampleRate);
+                return [resonance, input] (float* buffer, int n) { resonance->processBlock (buffer, input->data(), n); };
+            });
+
+        // Formants that never settle: a new target every block keeps the coefficient smoothing running
+        sweep ("ResonanceSystem", "scalar glide", 1, [] (double sampleRate, int blockSize)
+        {
+            auto resonance = std::make_shared<ResonanceSystem<float>>();
+            resonance->prepare (sampleRate);
+            auto input = std::make_shared<std::vector<float>> (static_cast<size_t> (blockSize));
+            fillTestSignal (input->data(), blockSize, sampleRate);
+            auto flip = std::make_shared<bool> (false);
+
+            return [resonance, input, flip] (float* buffer, int n)
+            {
+                *flip = ! *flip;
+                for (int i = 0; i < 5; ++i)
+                    resonance->setFormantFrequency (i, (*flip ? 300.0f : 600.0f) * static_cast<float> (i + 1));
+
+                resonance->processBlock (buffer, input->data(), n);
+            };
+        });
+
+        // The same, driven by creature size through a size table instead of by Hz
+        sweep ("ResonanceSystem", "scalar size glide", 1, [] (double sampleRate, int blockSize)
+        {
+            auto table = std::make_shared<FormantSizeTable>();
+            table->build (defaultFormantFreqs, defaultFormantQs, sampleRate, SizeScaler::Allometric);
+
+            auto resonance = std::make_shared<ResonanceSystem<float>>();
+            resonance->prepare (sampleRate);
+            resonance->setSizeTable (table.get());
+            auto input = std::make_shared<std::vector<float>> (static_cast<size_t> (blockSize));
+            fillTestSignal (input->data(), blockSize, sampleRate);
+            auto flip = std::make_shared<bool> (false);
+
+            return [table, resonance, input, flip] (float* buffer, int n)
+            {
+                *flip = ! *flip;
+                resonance->setLaneSize (0, *flip ? 10.0f : 2.4f);
+                resonance->processBlock (buffer, input->data(), n);
+            };
+        });
+
+        // Every voice gliding to its own size, as GrowlProcessor::setNoteSize does
+        sweep ("ResonanceSystem", "voice-lanes size glide", static_cast<int> (Lanes<VoiceLanes>::size), [] (double sampleRate, int blockSize)
+        {
+            auto table = std::make_shared<FormantSizeTable>();
+            table->build (defaultFormantFreqs, defaultFormantQs, sampleRate, SizeScaler::Allometric);
+
+            auto resonance = std::make_shared<ResonanceSystem<VoiceLanes>>();
+            resonance->prepare (sampleRate);
+            resonance->setSizeTable (table.get());
+            auto input = std::make_shared<std::vector<VoiceLanes>> (static_cast<size_t> (blockSize));
+            auto output = std::make_shared<std::vector<VoiceLanes>> (static_cast<size_t> (blockSize));
+            std::vector<float> signal (static_cast<size_t> (blockSize));
+            fillTestSignal (signal.data(), blockSize, sampleRate);
+
+            for (int i = 0; i < blockSize; ++i)
+                (*input)[static_cast<size_t> (i)] = VoiceLanes (signal[static_cast<size_t> (i)]);
+
+            auto flip = std::make_shared<bool> (false);
+
+            return [table, resonance, input, output, flip] (float* buffer, int n)
+            {
+                *flip = ! *flip;
+                for (size_t lane = 0; lane < Lanes<VoiceLanes>::size; ++lane)
+                    resonance->setLaneSize (lane, (*flip ? 10.0f : 2.4f) * static_cast<float> (lane + 1));
+
+                resonance->processBlock (output->data(), input->data(), n);
+                buffer[0] = Lanes<VoiceLanes>::get ((*output)[0], 0);
+            };
+        });
+
+        sweep ("ResonanceSystem", "voice-lanes", static_cast<int> (Lanes<VoiceLanes>::size), [] (double sampleRate, int blockSize)
+        {
+            auto resonance = std::make_shared<ResonanceSystem<VoiceLanes>>();
+            resonance->prepare (sampleRate);
+            auto input = std::make_shared<std::vector<VoiceLanes>> (static_cast<size_t> (blockSize));
+            auto output = std::make_shared<std::vector<VoiceLanes>> (static_cast<size_t> (blockSize));
+            std::vector<float> signal (static_cast<size_t> (blockSize));
+            fillTestSignal (signal.data(), blockSize, sampleRate);
+
+            for (int i = 0; i < blockSize; ++i)
+                (*input)[static_cast<size_t> (i)] = VoiceLanes (signal[static_cast<size_t> (i)]);
+
+            return [resonance, input, output] (float* buffer, int n)
+            {
+                resonance->processBlock (output->data(), input->data(), n);
+                buffer[0] = Lanes<VoiceLanes>::get ((*output)[0], 0);
+            };
+        });
+
+        sweep ("ResonanceSystem", "SVF", 1, [] (double sampleRate, int blockSize)
+        {
+            auto resonance = std::make_shared<ResonanceSystem<float>>();
+            resonance->setEngine (FormantEngine::StateVariable);
+            resonance->prepare (sampleRate);
+            auto input = std::make_shared<std::vector<float>> (static_cast<size_t> (blockSize));
+            fillTestSignal (input->data(), blockSize, sampleRate);
+            return [resonance, input] (float* buffer, int n) { resonance->processBlock (buffer, input->data(), n); };
+        });
+
+        // Every cutoff moves every sample: a 5 Hz jaw wobble of +/- half an octave
+        sweep ("ResonanceSystem", "SVF audio-rate", 1, [] (double sampleRate, int blockSize)
+        {
+            auto resonance = std::make_shared<ResonanceSystem<float>>();
+            resonance->setEngine (FormantEngine::StateVariable);
+            resonance->prepare (sampleRate);
+            auto input = std::make_shared<std::vector<float>> (static_cast<size_t> (blockSize));
+            auto multipliers = std::make_shared<std::vector<float>> (static_cast<size_t> (blockSize));
+            fillTestSignal (input->data(), blockSize, sampleRate);
+
+            for (int i = 0; i < blockSize; ++i)
+                (*multipliers)[static_cast<size_t> (i)] = static_cast<float> (std::exp2 (0.5 * std::sin (2.0 * M_PI * 5.0 * i / sampleRate)));
+
+            return [resonance, input, multipliers] (float* buffer, int n)
+            {
+                resonance->processBlock (buffer, input->data(), multipliers->data(), n);
+            };
+        });
+
+        sweep ("ResonanceSystem", "SVF audio-rate lanes", static_cast<int> (Lanes<VoiceLanes>::size), [] (double sampleRate, int blockSize)
+        {
+            auto resonance = std::make_shared<ResonanceSystem<VoiceLanes>>();
+            resonance->setEngine (FormantEngine::StateVariable);
+            resonance->prepare (sampleRate);
+            auto input = std::make_shared<std::vector<VoiceLanes>> (static_cast<size_t> (blockSize));
+            auto multipliers = std::make_shared<std::vector<VoiceLanes>> (static_cast<size_t> (blockSize));
+            auto output = std::make_shared<std::vector<VoiceLanes>> (static_cast<size_t> (blockSize));
+            std::vector<float> signal (static_cast<size_t> (blockSize));
+            fillTestSignal (signal.data(), blockSize, sampleRate);
+
+            for (int i = 0; i < blockSize; ++i)
+            {
+                (*input)[static_cast<size_t> (i)] = VoiceLanes (signal[static_cast<size_t> (i)]);
+                (*multipliers)[static_cast<size_t> (i)] = VoiceLanes (static_cast<float> (std::exp2 (0.5 * std::sin (2.0 * M_PI * 5.0 * i / sampleRate))));
+            }
+
+            return [resonance, input, multipliers, output] (float* buffer, int n)
+            {
+                resonance->processBlock (output->data(), input->data(), multipliers->data(), n);
+                buffer[0] = Lanes<VoiceLanes>::get ((*output)[0], 0);
+            };
+        });
+
+        for (const auto& [type, name] : distortionTypes)
+            sweep ("DistortionStage", name, 1, [type = type] (double sampleRate, int blockSize)
+            {
+                auto distortion = std::make_shared<Distortion>();
+                distortion->setDistortionType (type);
+                distortion->setDrive (3.0f);
+                auto input = std::make_shared<std::vector<float>> (static_cast<size_t> (blockSize));
+                fillTestSignal (input->data(), blockSize, sampleRate);
+                return [distortion, input] (float* buffer, int n) { distortion->processBlock (buffer, input->data(), n); };
+            });
+
+        sweep ("ModulationSystem", "LFOs+envelope", 1, [] (double sampleRate, int blockSize)
+        {
+            auto modulation = std::make_shared<ModulationSystem>();
+            modulation->prepare (sampleRate, blockSize);
+            modulation->noteOn();
+            return [modulation] (float* buffer, int n)
+            {
+                modulation->process (n);
+                buffer[0] = modulation->getLFOOutput (0);
+            };
+        });
+
+        const auto preset = FactoryPresets::getAllPresets().front();
+
+        // Up to 128 voices: one held voice per MIDI note
+        for (int voices : { 1, 16, 64, 128 })
+            sweep ("GrowlProcessor", preset.presetName, voices, [voices, preset] (double sampleRate, int blockSize)
+            {
+                auto processor = std::make_shared<GrowlProcessor>();
+                processor->prepare (sampleRate, blockSize);
+                processor->applyPreset (preset);
+
+                // Held notes, so no voice retires during the measurement
+                for (int v = 0; v < voices; ++v)
+                    processor->noteOn (v, 0.8f);
+
+                return [processor] (float* buffer, int n) { processor->processBlock (buffer, n); };
+            });
+    }
+
+    const std::vector<BenchResult>& getResults() const noexcept
+    {
+        return results;
+    }
+
+private:
+    /** Runs one module variant over every sample rate and block size; makeProcess builds fresh state per case. */
+    template <typename MakeProcess>
+    void sweep (const std::string& module, const std::string& variant, int voices, MakeProcess&& makeProcess)
+    {
+        if (! settings.filter.empty() && module.find (settings.filter) == std::string::npos)
+            return;
+
+        for (auto sampleRate : settings.sampleRates)
+        {
+            for (auto blockSize : settings.blockSizes)
+            {
+                auto result = measure (settings, sampleRate, blockSize, makeProcess (sampleRate, blockSize));
+                result.module = module;
+                result.variant = variant;
+                result.voices = voices;
+                results.push_back (result);
+
+                std::fprintf (stderr, "%-16s %-18s %3d voice(s) %6.0f Hz %4d: %9.2f ns/sample  RTF %.5f\n",
+                              module.c_str(), variant.c_str(), voices, sampleRate, blockSize,
+                              result.nsPerSample, result.realTimeFactor);
+            }
+        }
+    }
+
+    const BenchSettings& settings;
+    std::vector<BenchResult> results;
+};
+
+//==============================================================================
+void writeCsv (std::ostream& out, const std::string& label, const std::vector<BenchResult>& results)
+{
+    out << "label,module,variant,voices,sample_rate,block_size,ns_per_sample,ns_per_voice_sample,rtf\n";
+
+    for (const auto& r : results)
+        out << label << ',' << r.module << ',' << r.variant << ',' << r.voices << ',' << r.sampleRate << ','
+            << r.blockSize << ',' << r.nsPerSample << ',' << r.nsPerSample / r.voices << ',' << r.realTimeFactor << '\n';
+}
+
+void writeJson (std::ostream& out, const std::string& label, const std::vector<BenchResult>& results)
+{
+    out << "{\n  \"label\": \"" << label << "\",\n"
+        << "  \"simd_lanes\": " << Lanes<VoiceLanes>::size << ",\n"
+        << "  \"results\": [\n";
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& r = results[i];
+        out << "    { \"module\": \"" << r.module << "\", \"variant\": \"" << r.variant << "\", \"voices\": " << r.voices
+            << ", \"sample_rate\": " << r.sampleRate << ", \"block_size\": " << r.blockSize
+            << ", \"ns_per_sample\": " << r.nsPerSample << ", \"ns_per_voice_sample\": " << r.nsPerSample / r.voices
+            << ", \"rtf\": " << r.realTimeFactor << " }" << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+
+    out << "  ]\n}\n";
+}
+
+/** Prints baseline / current ns per sample for every case found in an earlier CSV run. */
+bool compareWithBaseline (const std::string& path, const std::vector<BenchResult>& results)
+{
+    std::ifstream in (path);
+
+    if (! in)
+    {
+        std::fprintf (stderr, "growl_bench: cannot read %s\n", path.c_str());
+        return false;
+    }
+
+    std::map<std::string, double> baseline;
+    std::string line;
+    std::getline (in, line);    // header
+
+    while (std::getline (in, line))
+    {
+        std::vector<std::string> fields;
+        std::stringstream row (line);
+
+        for (std::string field; std::getline (row, field, ',');)
+            fields.push_back (field);
+
+        if (fields.size() < 7)
+            continue;
+
+        BenchResult r;
+        r.module = fields[1];
+        r.variant = fields[2];
+        r.voices = std::atoi (fields[3].c_str());
+        r.sampleRate = std::atof (fields[4].c_str());
+        r.blockSize = std::atoi (fields[5].c_str());
+        baseline[r.key()] = std::atof (fields[6].c_str());
+    }
+
+    std::printf ("%-16s %-18s %6s %8s %6s %12s %12s %8s\n", "module", "variant", "voices", "rate", "block", "base ns", "ns", "speedup");
+
+    for (const auto& r : results)
+    {
+        const auto found = baseline.find (r.key());
+
+        if (found != baseline.end())
+            std::printf ("%-16s %-18s %6d %8.0f %6d %12.2f %12.2f %7.2fx\n", r.module.c_str(), r.variant.c_str(), r.voices,
+                         r.sampleRate, r.blockSize, found->second, r.nsPerSample, found->second / r.nsPerSample);
+    }
+
+    return true;
+}
+
+void printUsage()
+{
+    std::printf ("Usage: growl_bench [options]\n"
+                 "  --json                 write JSON instead of CSV\n"
+                 "  -o, --output <file>    write results to a file instead of stdout\n"
+                 "  --label <name>         label stored with every result (e.g. a commit id)\n"
+                 "  --filter <module>      only run modules whose name contains this text\n"
+                 "  --quick                block sizes 64/512/4096 at 48 kHz and 96 kHz only\n"
+                 "  --seconds <s>          audio rendered per repetition (default 0.5)\n"
+                 "  --repetitions <n>      repetitions per case, the fastest is kept (default 3)\n"
+                 "  --compare <file.csv>   print the speedup of this run against an earlier CSV\n"
+                 "  -h, --help             show this help\n");
+}
+
+} // namespace
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    BenchSettings settings;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "-h" || arg == "--help")                       { printUsage(); return 0; }
+        else if (arg == "--json")                                 settings.json = true;
+        else if (arg == "--quick")
+        {
+            settings.blockSizes = { 64, 512, 4096 };
+            settings.sampleRates = { 48000.0, 96000.0 };
+        }
+        else if ((arg == "-o" || arg == "--output") && hasValue)  settings.outputPath = argv[++i];
+        else if (arg == "--label" && hasValue)                    settings.label = argv[++i];
+        else if (arg == "--filter" && hasValue)                   settings.filter = argv[++i];
+        else if (arg == "--seconds" && hasValue)                  settings.secondsPerCase = juce::jmax (0.01, std::atof (argv[++i]));
+        else if (arg == "--repetitions" && hasValue)              settings.repetitions = juce::jmax (1, std::atoi (argv[++i]));
+        else if (arg == "--compare" && hasValue)                  settings.comparePath = argv[++i];
+        else
+        {
+            std::fprintf (stderr, "growl_bench: unknown option %s\n", arg.c_str());
+            printUsage();
+            return 1;
+        }
+    }
+
+    Bench bench (settings);
+    bench.runAll();
+
+    if (! settings.comparePath.empty())
+        return compareWithBaseline (settings.comparePath, bench.getResults()) ? 0 : 1;
+
+    std::ofstream file;
+    if (! settings.outputPath.empty())
+        file.open (settings.outputPath);
+
+    std::ostream& out = settings.outputPath.empty() ? std::cout : file;
+
+    if (settings.json)
+        writeJson (out, settings.label, bench.getResults());
+    else
+        writeCsv (out, settings.label, bench.getResults());
+
+    return out.good() ? 0 : 1;
+}
@@ -0,0 +1,578 @@
+/*
+  ==============================================================================
+
+    GrowlRender.cpp
+    Created: 17 Oct 2026 4:00:00pm
+    Author:  White Room Audio
+
+    Headless offline renderer: plays a factory preset from a MIDI file or a
+    note list straight into a WAV file, as fast as the machine allows.
+    Jobs run one per thread across all cores, and each job reports its
+    real-time factor.
+
+  ==============================================================================
+*/
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_audio_formats/juce_audio_formats.h>
+#include "dsp/GrowlProcessor.h"
+#include "dsp/FactoryPresets.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+//==============================================================================
+struct NoteEvent
+{
+    int noteNumber = 60;
+    double start = 0.0;         // seconds
+    double length = 1.0;        // seconds
+    float velocity = 0.8f;
+};
+
+struct RenderJob
+{
+    int presetIndex = 0;
+    std::string midiPath;
+    std::vector<NoteEvent> notes;
+    std::string outputPath;
+
+    double sampleRate = 48000.0;
+    int blockSize = 512;
+    int bitsPerSample = 24;
+    double tailSeconds = 2.0;
+    int oversampling = 1;                   // log2 of the factor, as in GrowlProcessor
+    bool linearPhase = false;
+};
+
+struct RenderResult
+{
+    bool ok = false;
+    std::string message;
+    double audioSeconds = 0.0;
+    double renderSeconds = 0.0;
+};
+
+struct TimedMessage
+{
+    int64_t samplePosition;
+    juce::MidiMessage message;
+};
+
+void printUsage()
+{
+    std::printf ("Usage: growl_render [options]\n"
+                 "\n"
+                 "Job options:\n"
+                 "  -p, --preset <index|name>   factory preset (default 0)\n"
+                 "  -m, --midi <file.mid>       MIDI file to play\n"
+                 "  -n, --notes <list>          notes as note:start:length[:velocity],... in seconds\n"
+                 "  -o, --output <file.wav>     output file (a directory with --all-presets)\n"
+                 "  -r, --rate <hz>             sample rate (default 48000)\n"
+                 "  -b, --bits <16|24|32>       bit depth, 32 is float (default 24)\n"
+                 "      --block <samples>       render block size (default 512)\n"
+                 "      --tail <seconds>        time rendered after the last event (default 2)\n"
+                 "  -x, --oversampling <0-3>    distortion oversampling 1x/2x/4x/8x (default 1 = 2x)\n"
+                 "      --linear-phase          linear-phase oversampling filters\n"
+                 "\n"
+                 "Batch options:\n"
+                 "  -j, --jobs <file>           job file, one job per line using the job options\n"
+                 "      --all-presets           render the notes once with every factory preset\n"
+                 "  -T, --threads <n>           worker threads (default: all cores)\n"
+                 "      --list                  list the factory presets\n"
+                 "  -h, --help                  show this help\n");
+}
+
+//==============================================================================
+std::string lowerCase (std::string text)
+{
+    std::transform (text.begin(), text.end(), text.begin(), [] (unsigned char c) { return static_cast<char> (std::tolower (c)); });
+    return text;
+}
+
+int findPreset (const std::string& nameOrIndex, const std::vector<PresetParameters>& presets)
+{
+    if (! nameOrIndex.empty() && std::all_of (nameOrIndex.begin(), nameOrIndex.end(), [] (unsigned char c) { return std::isdigit (c) != 0; }))
+    {
+        const int index = std::stoi (nameOrIndex);
+        return juce::isPositiveAndBelow (index, static_cast<int> (presets.size())) ? index : -1;
+    }
+
+    const auto wanted = lowerCase (nameOrIndex);
+
+    for (size_t i = 0; i < presets.size(); ++i)
+        if (lowerCase (presets[i].presetName) == wanted || lowerCase (presets[i].animalName) == wanted)
+            return static_cast<int> (i);
+
+    return -1;
+}
+
+bool parseNotes (const std::string& list, std::vector<NoteEvent>& notes)
+{
+    std::stringstream entries (list);
+    std::string entry;
+
+    while (std::getline (entries, entry, ','))
+    {
+        NoteEvent note;
+        char separator = 0;
+        std::stringstream fields (entry);
+
+        fields >> note.noteNumber >> separator >> note.start >> separator >> note.length;
+
+        if (fields.fail() || ! juce::isPositiveAndBelow (note.noteNumber, 128) || note.start < 0.0 || note.length <= 0.0)
+            return false;
+
+        if (fields >> separator >> note.velocity)
+            note.velocity = juce::jlimit (0.0f, 1.0f, note.velocity);
+
+        notes.push_back (note);
+    }
+
+    return ! notes.empty();
+}
+
+/** Splits a job-file line into arguments, honouring double quotes. */
+std::vector<std::string> tokenise (const std::string& line)
+{
+    std::vector<std::string> tokens;
+    std::string current;
+    bool inQuotes = false, hasToken = false;
+
+    for (char c : line)
+    {
+        if (c == '"')
+        {
+            inQuotes = ! inQuotes;
+            hasToken = true;
+        }
+        else if (std::isspace (static_cast<unsigned char> (c)) && ! inQuotes)
+        {
+            if (hasToken)
+                tokens.push_back (current);
+
+            current.clear();
+            hasToken = false;
+        }
+        else
+        {
+            current += c;
+            hasToken = true;
+        }
+    }
+
+    if (hasToken)
+        tokens.push_back (current);
+
+    return tokens;
+}
+
+/**
+    Applies job options to job. Batch options are collected into batchOptions
+    (when given) so that the same parser serves the command line and job files.
+*/
+bool parseJobOptions (const std::vector<std::string>& args, RenderJob& job,
+                      const std::vector<PresetParameters>& presets, std::string& error,
+                      std::vector<std::string>* batchOptions = nullptr)
+{
+    for (size_t i = 0; i < args.size(); ++i)
+    {
+        const auto& arg = args[i];
+        const bool hasValue = i + 1 < args.size();
+        auto is = [&arg] (const char* shortName, const char* longName) { return arg == shortName || arg == longName; };
+
+        if (is ("-h", "--help") || arg == "--all-presets" || arg == "--list")
+        {
+            if (batchOptions == nullptr)
+            {
+                error = arg + " is only valid on the command line";
+                return false;
+            }
+
+            batchOptions->push_back (arg);
+            continue;
+        }
+
+        if (arg == "--linear-phase")
+        {
+            job.linearPhase = true;
+            continue;
+        }
+
+        if (! hasValue)
+        {
+            error = "missing value for " + arg;
+            return false;
+        }
+
+        const auto& value = args[++i];
+
+        try
+        {
+            if (is ("-p", "--preset"))
+            {
+                job.presetIndex = findPreset (value, presets);
+
+                if (job.presetIndex < 0)
+                {
+                    error = "unknown preset '" + value + "' (see --list)";
+                    return false;
+                }
+            }
+            else if (is ("-m", "--midi"))           job.midiPath = value;
+            else if (is ("-o", "--output"))         job.outputPath = value;
+            else if (is ("-r", "--rate"))           job.sampleRate = juce::jlimit (8000.0, 384000.0, std::stod (value));
+            else if (is ("-b", "--bits"))           job.bitsPerSample = std::stoi (value);
+            else if (arg == "--block")             job.blockSize = juce::jlimit (16, 8192, std::stoi (value));
+            else if (arg == "--tail")              job.tailSeconds = juce::jmax (0.0, std::stod (value));
+            else if (is ("-x", "--oversampling"))   job.oversampling = juce::jlimit (0, 3, std::stoi (value));
+            else if (is ("-n", "--notes"))
+            {
+                if (! parseNotes (value, job.notes))
+                {
+                    error = "bad note list '" + value + "'";
+                    return false;
+                }
+            }
+            else if (batchOptions != nullptr && (is ("-j", "--jobs") || is ("-T", "--threads")))
+            {
+                batchOptions->push_back (arg);
+                batchOptions->push_back (value);
+            }
+            else
+            {
+                error = "unknown option " + arg;
+                return false;
+            }
+        }
+        catch (const std::exception&)
+        {
+            error = "bad value '" + value + "' for " + arg;
+            return false;
+        }
+    }
+
+    if (job.bitsPerSample != 16 && job.bitsPerSample != 24 && job.bitsPerSample != 32)
+    {
+        error = "bit depth must be 16, 24 or 32";
+        return false;
+    }
+
+    return true;
+}
+
+//==============================================================================
+bool collectEvents (const RenderJob& job, std::vector<TimedMessage>& events, std::string& error)
+{
+    const auto toSamples = [&job] (double seconds) { return static_cast<int64_t> (seconds * job.sampleRate + 0.5); };
+
+    if (! job.midiPath.empty())
+    {
+        const auto file = juce::File::getCurrentWorkingDirectory().getChildFile (job.midiPath);
+        juce::FileInputStream stream (file);
+        juce::MidiFile midiFile;
+
+        if (! stream.openedOk() || ! midiFile.readFrom (stream))
+        {
+            error = "cannot read MIDI file " + job.midiPath;
+            return false;
+        }
+
+        midiFile.convertTimestampTicksToSeconds();
+
+        for (int track = 0; track < midiFile.getNumTracks(); ++track)
+        {
+            const auto* sequence = midiFile.getTrack (track);
+
+            for (int i = 0; i < sequence->getNumEvents(); ++i)
+            {
+                const auto& message = sequence->getEventPointer (i)->message;
+
+                if (message.isNoteOnOrOff() || message.isAllNotesOff() || message.isAllSoundOff())
+                    events.push_back ({ toSamples (message.getTimeStamp()), message });
+            }
+        }
+    }
+
+    for (const auto& note : job.notes)
+    {
+        events.push_back ({ toSamples (note.start), juce::MidiMessage::noteOn (1, note.noteNumber, note.velocity) });
+        events.push_back ({ toSamples (note.start + note.length), juce::MidiMessage::noteOff (1, note.noteNumber) });
+    }
+
+    // Stable, so a note-off and a note-on on the same sample keep their order
+    std::stable_sort (events.begin(), events.end(),
+                      [] (const TimedMessage& a, const TimedMessage& b) { return a.samplePosition < b.samplePosition; });
+
+    if (events.empty())
+    {
+        error = "nothing to play: give --midi or --notes";
+        return false;
+    }
+
+    return true;
+}
+
+bool writeWav (const RenderJob& job, const float* samples, int numSamples, std::string& error)
+{
+    const auto file = juce::File::getCurrentWorkingDirectory().getChildFile (job.outputPath);
+    file.getParentDirectory().createDirectory();
+    file.deleteFile();
+
+    auto stream = std::make_unique<juce::FileOutputStream> (file);
+
+    if (stream->failedToOpen())
+    {
+        error = "cannot write " + job.outputPath;
+        return false;
+    }
+
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatWriter> writer (wav.createWriterFor (stream.get(), job.sampleRate, 1,
+                                                                          job.bitsPerSample, {}, 0));
+    if (writer == nullptr)
+    {
+        error = "cannot create a WAV writer for " + job.outputPath;
+        return false;
+    }
+
+    stream.release(); // now owned by the writer
+
+    const float* channels[] = { samples };
+    return writer->writeFromFloatArrays (channels, 1, numSamples);
+}
+
+RenderResult renderJob (const RenderJob& job, const std::vector<PresetParameters>& presets)
+{
+    RenderResult result;
+    std::vector<TimedMessage> events;
+
+    if (! collectEvents (job, events, result.message))
+        return result;
+
+    const auto& preset = presets[static_cast<size_t> (job.presetIndex)];
+
+    // One voice-rendering thread per job: the batch is spread across cores instead
+    auto processor = std::make_unique<Growl::DSP::GrowlProcessor>();
+    processor->setOversampling (job.oversampling, job.linearPhase ? Growl::DSP::OversamplingFilter::LinearPhase
+                                                                  : Growl::DSP::OversamplingFilter::MinimumPhase);
+    processor->prepare (job.sampleRate, job.blockSize);
+    processor->applyPreset (preset);
+
+    // Render the latency away so the file starts exactly at time zero
+    const int latency = processor->getLatencyInSamples();
+    const auto audioLength = events.back().samplePosition + static_cast<int64_t> (job.tailSeconds * job.sampleRate);
+    const auto totalLength = audioLength + latency;
+
+    std::vector<float> rendered (static_cast<size_t> (totalLength), 0.0f);
+    juce::MidiBuffer midi;
+    size_t nextEvent = 0;
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    for (int64_t start = 0; start < totalLength; start += job.blockSize)
+    {
+        const auto numSamples = static_cast<int> (std::min<int64_t> (job.blockSize, totalLength - start));
+
+        midi.clear();
+        while (nextEvent < events.size() && events[nextEvent].samplePosition < start + numSamples)
+        {
+            midi.addEvent (events[nextEvent].message, static_cast<int> (events[nextEvent].samplePosition - start));
+            ++nextEvent;
+        }
+
+        processor->processBlock (rendered.data() + start, numSamples, midi);
+    }
+
+    juce::FloatVectorOperations::multiply (rendered.data(), juce::Decibels::decibelsToGain (preset.masterGain),
+                                           static_cast<int> (totalLength));
+
+    result.renderSeconds = std::chrono::duration<double> (std::chrono::steady_clock::now() - startTime).count();
+    result.audioSeconds = static_cast<double> (audioLength) / job.sampleRate;
+
+    if (! writeWav (job, rendered.data() + latency, static_cast<int> (audioLength), result.message))
+        return result;
+
+    result.ok = true;
+    return result;
+}
+
+std::string defaultFileName (const PresetParameters& preset)
+{
+    std::string name = preset.presetName;
+
+    for (auto& c : name)
+        if (! std::isalnum (static_cast<unsigned char> (c)))
+            c = '_';
+
+    return name + ".wav";
+}
+
+} // namespace
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    const auto presets = FactoryPresets::getAllPresets();
+
+    RenderJob defaults;
+    std::vector<std::string> batchOptions;
+    std::string error;
+
+    if (! parseJobOptions (std::vector<std::string> (argv + 1, argv + argc), defaults, presets, error, &batchOptions))
+    {
+        std::fprintf (stderr, "growl_render: %s\n", error.c_str());
+        return 1;
+    }
+
+    bool allPresets = false;
+    std::string jobFile;
+    int numThreads = static_cast<int> (std::thread::hardware_concurrency());
+
+    for (size_t i = 0; i < batchOptions.size(); ++i)
+    {
+        const auto& option = batchOptions[i];
+
+        if (option == "-h" || option == "--help")
+        {
+            printUsage();
+            return 0;
+        }
+
+        if (option == "--list")
+        {
+            for (size_t p = 0; p < presets.size(); ++p)
+                std::printf ("%2d  %s (%s)\n", static_cast<int> (p), presets[p].presetName.c_str(), presets[p].animalName.c_str());
+
+            return 0;
+        }
+
+        if (option == "--all-presets")          allPresets = true;
+        else if (option == "-j" || option == "--jobs")     jobFile = batchOptions[++i];
+        else if (option == "-T" || option == "--threads")  numThreads = std::atoi (batchOptions[++i].c_str());
+    }
+
+    // Build the job list
+    std::vector<RenderJob> jobs;
+
+    if (! jobFile.empty())
+    {
+        std::ifstream input (jobFile);
+
+        if (! input)
+        {
+            std::fprintf (stderr, "growl_render: cannot read job file %s\n", jobFile.c_str());
+            return 1;
+        }
+
+        std::string line;
+        for (int lineNumber = 1; std::getline (input, line); ++lineNumber)
+        {
+            const auto args = tokenise (line);
+
+            if (args.empty() || args.front()[0] == '#')
+                continue;
+
+            auto job = defaults;
+            job.notes.clear();
+            job.midiPath.clear();
+
+            if (! parseJobOptions (args, job, presets, error))
+            {
+                std::fprintf (stderr, "growl_render: %s:%d: %s\n", jobFile.c_str(), lineNumber, error.c_str());
+                return 1;
+            }
+
+            jobs.push_back (job);
+        }
+    }
+    else if (allPresets)
+    {
+        for (size_t p = 0; p < presets.size(); ++p)
+        {
+            auto job = defaults;
+            job.presetIndex = static_cast<int> (p);
+            job.outputPath = (defaults.outputPath.empty() ? std::string (".") : defaults.outputPath) + "/" + defaultFileName (presets[p]);
+            jobs.push_back (job);
+        }
+    }
+    else
+    {
+        jobs.push_back (defaults);
+    }
+
+    for (auto& job : jobs)
+        if (job.outputPath.empty())
+            job.outputPath = defaultFileName (presets[static_cast<size_t> (job.presetIndex)]);
+
+    if (jobs.size() == 1 && jobs.front().midiPath.empty() && jobs.front().notes.empty())
+    {
+        printUsage();
+        return 1;
+    }
+
+    // One job per thread; each thread pulls the next job when it finishes
+    numThreads = juce::jlimit (1, static_cast<int> (jobs.size()), numThreads);
+
+    std::atomic<size_t> nextJob { 0 };
+    std::atomic<int> numFailed { 0 };
+    std::mutex printLock;
+    double totalAudio = 0.0;
+
+    const auto batchStart = std::chrono::steady_clock::now();
+
+    auto worker = [&]
+    {
+        for (auto index = nextJob.fetch_add (1); index < jobs.size(); index = nextJob.fetch_add (1))
+        {
+            const auto& job = jobs[index];
+            const auto result = renderJob (job, presets);
+
+            const std::lock_guard<std::mutex> lock (printLock);
+
+            if (result.ok)
+            {
+                totalAudio += result.audioSeconds;
+                std::printf ("[%zu/%zu] %-24s -> %s  %.2f s in %.3f s  (%.1fx real time, RTF %.4f)\n",
+                             index + 1, jobs.size(),
+                             presets[static_cast<size_t> (job.presetIndex)].presetName.c_str(), job.outputPath.c_str(),
+                             result.audioSeconds, result.renderSeconds,
+                             result.audioSeconds / juce::jmax (1.0e-9, result.renderSeconds),
+                             result.renderSeconds / juce::jmax (1.0e-9, result.audioSeconds));
+            }
+            else
+            {
+                ++numFailed;
+                std::fprintf (stderr, "[%zu/%zu] %s: %s\n", index + 1, jobs.size(), job.outputPath.c_str(), result.message.c_str());
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < numThreads; ++t)
+        threads.emplace_back (worker);
+
+    worker();
+
+    for (auto& thread : threads)
+        thread.join();
+
+    const auto wallSeconds = std::chrono::duration<double> (std::chrono::steady_clock::now() - batchStart).count();
+
+    std::printf ("%zu job(s), %.2f s of audio in %.3f s on %d thread(s): %.1fx real time overall\n",
+                 jobs.size(), totalAudio, wallSeconds, numThreads, totalAudio / juce::jmax (1.0e-9, wallSeconds));
+
+    return numFailed.load() == 0 ? 0 : 1;
+}